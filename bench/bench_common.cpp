@@ -0,0 +1,53 @@
+#include "bench_common.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+#include "rtss/io/input.h"
+#include "rtss/tasktable.h"
+
+namespace rtss {
+    std::unique_ptr<Task> Task::_idle = std::make_unique<Task>(time::TimeDuration::zero(), time::TimeDuration::zero());
+}
+
+namespace rtss::bench {
+    void make_task_set(size_t ntasks, generators::TaskStorage &storage) {
+        generators::GeneratorParams params;
+        params.nperiodic = ntasks;
+        params.utilisation = 0.7;
+        params.method = generators::UtilisationMethod::RANDFIXEDSUM;
+        params.periods = generators::PeriodDistribution::HARMONIC;
+        params.period_min_ms = 10;
+        params.period_max_ms = 1280;
+        TaskSet ts;
+        generators::TaskSetGenerator(ntasks).generate(params, ts);
+        generators::make_tasks(ts, storage);
+    }
+
+    std::filesystem::path write_task_list_csv(size_t ntasks) {
+        auto path = std::filesystem::temp_directory_path() / ("rtss_bench_tasks_" + std::to_string(ntasks) + ".csv");
+        generators::TaskStorage storage;
+        make_task_set(ntasks, storage);
+        std::ofstream ofs(path);
+        ofs << "type,phase,period,wcet,rel_dl\n";
+        // The CSV format has whole milliseconds only.
+        for (const auto &P: storage.periodic) {
+            ofs << "P," << time::toInt(P.get_phase()) << "," << time::toInt(P.get_period()) << ","
+                    << std::max<int64_t>(1, time::toInt(P.get_wcet())) << "," << time::toInt(P.get_rel_dl()) << "\n";
+        }
+        return path;
+    }
+
+    std::filesystem::path write_task_table_csv(size_t nentries) {
+        auto path = std::filesystem::temp_directory_path() / ("rtss_bench_table_" + std::to_string(nentries) + ".csv");
+        TaskTableBuilder builder;
+        builder.reserve(nentries + 1);
+        for (size_t k = 0; k < nentries; k++) {
+            builder.add_entry(static_cast<int16_t>(k % 100), time::createTimeDurationMs(static_cast<int>(2 * k)));
+        }
+        builder.add_entry(static_cast<int16_t>(TaskID::RESET), time::createTimeDurationMs(static_cast<int>(2 * nentries)));
+        io::write_task_table_csv(builder, path);
+        return path;
+    }
+}
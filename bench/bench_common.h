@@ -0,0 +1,25 @@
+#ifndef RTSS_BENCH_COMMON_H
+#define RTSS_BENCH_COMMON_H
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "rtss/generators/taskset_generator.h"
+
+namespace rtss::bench {
+    // Task counts every benchmark is run for (10 to 100k).
+    constexpr int64_t MIN_TASKS = 10;
+    constexpr int64_t MAX_TASKS = 100000;
+
+    // Seeded periodic task set: harmonic periods between 10ms and 1280ms (hyperperiod 1280ms),
+    // total utilisation 0.7 and implicit deadlines, so the schedule has no overload at any size.
+    void make_task_set(size_t ntasks, generators::TaskStorage &storage);
+
+    // Task list CSV of `ntasks` tasks and schedule table CSV of `nentries` entries, in the temp directory.
+    std::filesystem::path write_task_list_csv(size_t ntasks);
+
+    std::filesystem::path write_task_table_csv(size_t nentries);
+}
+
+#endif
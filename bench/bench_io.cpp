@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+#include "bench_common.h"
+#include "rtss/io/binary.h"
+#include "rtss/io/input.h"
+#include "rtss/tasktable.h"
+
+using namespace rtss;
+
+namespace {
+    void BM_ReadTaskListCSV(benchmark::State &state) {
+        auto path = bench::write_task_list_csv(state.range(0));
+        for (auto _: state) {
+            std::vector<Task *> tasks;
+            io::Metadata meta;
+            io::read_task_list_from_csv(tasks, path.string(), meta);
+            benchmark::DoNotOptimize(tasks.data());
+            for (auto *T: tasks) delete T;
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+        std::filesystem::remove(path);
+    }
+
+    // Same, with the tasks in one arena instead of one allocation each.
+    void BM_ReadTaskListCSVStore(benchmark::State &state) {
+        auto path = bench::write_task_list_csv(state.range(0));
+        for (auto _: state) {
+            TaskStore store;
+            io::Metadata meta;
+            io::read_task_list_from_csv(store, path.string(), meta);
+            benchmark::DoNotOptimize(store.tasks().data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+        std::filesystem::remove(path);
+    }
+
+    // range(0) entries, parsed on range(1) threads.
+    void BM_ReadTaskTableCSV(benchmark::State &state) {
+        auto path = bench::write_task_table_csv(state.range(0));
+        for (auto _: state) {
+            TaskTableBuilder builder;
+            io::read_task_table_from_csv(builder, path.string(), static_cast<size_t>(state.range(1)));
+            benchmark::DoNotOptimize(builder.entries().data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+        std::filesystem::remove(path);
+    }
+
+    // range(0) entries from a binary table; range(1) = 1 for delta-encoded start times.
+    // Loading a fixed-width table only maps it, so touching every entry is part of the loop.
+    void BM_LoadTaskTableBinary(benchmark::State &state) {
+        auto csv_path = bench::write_task_table_csv(state.range(0));
+        auto path = std::filesystem::path(csv_path).replace_extension(".bin");
+        io::convert_task_table_csv_to_binary(csv_path.string(), path, state.range(1) != 0);
+        for (auto _: state) {
+            TaskTable tbl = io::load_task_table_binary(path.string());
+            int64_t sum = 0;
+            for (size_t k = 0; k < tbl.size(); k++) sum += tbl.get_kth_entry(k).task_id;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+        std::filesystem::remove(csv_path);
+        std::filesystem::remove(path);
+    }
+}
+
+BENCHMARK(BM_ReadTaskListCSV)->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS);
+BENCHMARK(BM_ReadTaskListCSVStore)->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS);
+BENCHMARK(BM_ReadTaskTableCSV)->ArgNames({"entries", "threads"})
+        ->ArgsProduct({benchmark::CreateRange(bench::MIN_TASKS, 10 * bench::MAX_TASKS, 10), {1}})
+        ->Args({10 * bench::MAX_TASKS, 2})->Args({10 * bench::MAX_TASKS, 4})->Args({10 * bench::MAX_TASKS, 0})
+        ->UseRealTime();
+BENCHMARK(BM_LoadTaskTableBinary)->ArgNames({"entries", "delta"})
+        ->ArgsProduct({benchmark::CreateRange(bench::MIN_TASKS, 10 * bench::MAX_TASKS, 10), {0, 1}});
@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include "rtss/logging/event_log.h"
+
+using namespace rtss;
+
+namespace {
+    // Cost of one record on the logging thread; the drain thread runs concurrently without sinks.
+    void BM_LogRecord(benchmark::State &state) {
+        logging::EventLogger logger;
+        int64_t t = 0;
+        for (auto _: state) {
+            logger.log({t++, 1'000'000, 3, 0, logging::EventKind::DISPATCH});
+        }
+        logger.flush();
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // A level that is compiled in but switched off at run time.
+    void BM_LogRecordDisabled(benchmark::State &state) {
+        logging::EventLogger logger;
+        logger.set_level(logging::LogLevel::EVENTS);
+        int64_t t = 0;
+        for (auto _: state) {
+            if (logger.enabled(logging::LogLevel::JOBS)) {
+                logger.log({t, 1'000'000, 3, 0, logging::EventKind::DISPATCH});
+            }
+            benchmark::DoNotOptimize(t++);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_LogRecord);
+BENCHMARK(BM_LogRecordDisabled);
@@ -0,0 +1,208 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "bench_common.h"
+#include "rtss/clock.h"
+#include "rtss/tasktable.h"
+#include "rtss/analysis/partition.h"
+#include "rtss/metrics/recorder.h"
+#include "rtss/schedulers/dynamic.h"
+#include "rtss/schedulers/global.h"
+#include "rtss/schedulers/preemptive.h"
+#include "rtss/schedulers/static.h"
+#include "rtss/schedulers/table_generator.h"
+
+using namespace rtss;
+
+namespace {
+    // Exposes PriorityBasedScheduler::assign_priorities().
+    template<typename Scheduler>
+    class PriorityProbe : public Scheduler {
+    public:
+        using Scheduler::Scheduler;
+
+        void assign() { this->assign_priorities(this->pri_idx); }
+    };
+
+    template<typename Scheduler>
+    void BM_AssignPriorities(benchmark::State &state) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        PriorityProbe<Scheduler> sched(storage.tasks);
+        for (auto _: state) {
+            sched.assign();
+            benchmark::DoNotOptimize(sched.get_priority_order().data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // One cycle of the non-preemptive scheduler: one decision per task.
+    template<typename Scheduler>
+    void BM_PriorityDispatch(benchmark::State &state) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        Scheduler sched(storage.tasks);
+        sched.set_clock(std::make_unique<time::VirtualClock>());
+        sched.set_verbose(false);
+        for (auto _: state) {
+            sched.run_scheduler(1);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // One hyperperiod; every job start or resumption counts as a decision.
+    void BM_PreemptiveDispatch(benchmark::State &state, schedulers::PreemptivePolicy policy) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        auto sched = schedulers::make_preemptive_scheduler(storage.tasks, policy);
+        sched->set_clock(std::make_unique<time::VirtualClock>());
+        sched->set_verbose(false);
+        int64_t decisions = 0;
+        for (auto _: state) {
+            sched->run_scheduler(1);
+            decisions += static_cast<int64_t>(sched->get_stats().completed_jobs + sched->get_stats().preemptions);
+        }
+        state.SetItemsProcessed(decisions);
+    }
+
+    // One hyperperiod on range(1) cores; the task set is scaled to the same load per core.
+    void BM_GlobalDispatch(benchmark::State &state, schedulers::GlobalPolicy policy) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        const auto ncores = static_cast<size_t>(state.range(1));
+        for (auto *t: storage.tasks) {
+            t->set_wcet(t->get_wcet() * static_cast<int64_t>(ncores));
+        }
+        auto sched = schedulers::make_global_scheduler(storage.tasks, ncores, policy);
+        sched->set_clock(std::make_unique<time::VirtualClock>());
+        sched->set_verbose(false);
+        int64_t decisions = 0;
+        for (auto _: state) {
+            sched->run_scheduler(1);
+            decisions += static_cast<int64_t>(sched->get_stats().completed_jobs + sched->get_stats().preemptions);
+        }
+        state.SetItemsProcessed(decisions);
+    }
+
+    // Worst-fit decreasing partitioning onto range(1) cores, at the same load per core as BM_GlobalDispatch.
+    void BM_PartitionTasks(benchmark::State &state, analysis::AcceptanceTest test) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        const auto ncores = static_cast<size_t>(state.range(1));
+        for (auto *t: storage.tasks) {
+            t->set_wcet(t->get_wcet() * static_cast<int64_t>(ncores));
+        }
+        size_t exact_tests = 0;
+        for (auto _: state) {
+            auto partition = analysis::partition_tasks(storage.tasks, ncores,
+                                                       analysis::FitHeuristic::WORST_FIT_DECREASING, test);
+            exact_tests = partition.exact_tests;
+            benchmark::DoNotOptimize(partition.core_of.data());
+        }
+        state.counters["exact_tests"] = static_cast<double>(exact_tests);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // BM_PreemptiveDispatch/EDF with a MetricsRecorder attached, to compare against it.
+    void BM_PreemptiveDispatchWithMetrics(benchmark::State &state) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        auto sched = schedulers::make_preemptive_scheduler(storage.tasks, schedulers::PreemptivePolicy::EDF);
+        sched->set_clock(std::make_unique<time::VirtualClock>());
+        sched->set_verbose(false);
+        metrics::MetricsRecorder recorder(storage.tasks);
+        sched->add_observer(&recorder);
+        int64_t decisions = 0;
+        for (auto _: state) {
+            sched->run_scheduler(1);
+            decisions += static_cast<int64_t>(sched->get_stats().completed_jobs + sched->get_stats().preemptions);
+        }
+        benchmark::DoNotOptimize(recorder.total().response_tm.max());
+        state.SetItemsProcessed(decisions);
+    }
+
+    void BM_TableDrivenDispatch(benchmark::State &state) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        TaskTableBuilder builder;
+        schedulers::generate_task_table(storage.tasks, schedulers::PreemptivePolicy::EDF, builder);
+        const auto nentries = static_cast<int64_t>(builder.size());
+        TaskTable tbl = builder.build(StaticSchedulingMode::TASK_BASED);
+        schedulers::TableDrivenScheduler sched(storage.tasks, tbl);
+        sched.set_clock(std::make_unique<time::VirtualClock>());
+        sched.set_verbose(false);
+        for (auto _: state) {
+            sched.run_scheduler(1);
+        }
+        state.SetItemsProcessed(state.iterations() * nentries);
+    }
+
+    void BM_CyclicExecutiveDispatch(benchmark::State &state) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        TaskTableBuilder builder;
+        schedulers::generate_task_table(storage.tasks, schedulers::PreemptivePolicy::EDF, builder);
+        TaskTable tbl = builder.build(StaticSchedulingMode::FRAME_BASED, time::createTimeDurationMs(10),
+                                      storage.tasks);
+        const FrameContainer *frames = tbl.get_frame_container();
+        schedulers::CyclicExecutiveScheduler sched(storage.tasks, tbl);
+        sched.set_clock(std::make_unique<time::VirtualClock>());
+        sched.set_verbose(false);
+        for (auto _: state) {
+            sched.run_scheduler(1);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(frames->size()));
+    }
+
+    void BM_CreateFrames(benchmark::State &state) {
+        generators::TaskStorage storage;
+        bench::make_task_set(state.range(0), storage);
+        TaskTableBuilder builder;
+        schedulers::generate_task_table(storage.tasks, schedulers::PreemptivePolicy::EDF, builder);
+        for (auto _: state) {
+            TaskTable tbl = builder.build(StaticSchedulingMode::FRAME_BASED, time::createTimeDurationMs(10),
+                                          storage.tasks);
+            benchmark::DoNotOptimize(tbl.get_frame_container());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(builder.size()));
+    }
+}
+
+// The non-preemptive schedulers rescan the priority list after every job (O(n) per decision)
+// and schedule tables hold 15-bit task ids, so those stop at 10k tasks.
+constexpr int64_t MAX_SCAN_TASKS = 10000;
+
+BENCHMARK_TEMPLATE(BM_AssignPriorities, schedulers::RM)->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS);
+BENCHMARK_TEMPLATE(BM_AssignPriorities, schedulers::DM)->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS);
+BENCHMARK_TEMPLATE(BM_AssignPriorities, schedulers::EDF)->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS);
+BENCHMARK_TEMPLATE(BM_AssignPriorities, schedulers::LLF)->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS);
+
+BENCHMARK_TEMPLATE(BM_PriorityDispatch, schedulers::RM)->RangeMultiplier(10)->Range(bench::MIN_TASKS, MAX_SCAN_TASKS);
+BENCHMARK_TEMPLATE(BM_PriorityDispatch, schedulers::DM)->RangeMultiplier(10)->Range(bench::MIN_TASKS, MAX_SCAN_TASKS);
+BENCHMARK_TEMPLATE(BM_PriorityDispatch, schedulers::EDF)->RangeMultiplier(10)->Range(bench::MIN_TASKS, MAX_SCAN_TASKS);
+BENCHMARK_TEMPLATE(BM_PriorityDispatch, schedulers::LLF)->RangeMultiplier(10)->Range(bench::MIN_TASKS, MAX_SCAN_TASKS);
+
+BENCHMARK_CAPTURE(BM_PreemptiveDispatch, EDF, schedulers::PreemptivePolicy::EDF)
+        ->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PreemptiveDispatch, LLF, schedulers::PreemptivePolicy::LLF)
+        ->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PreemptiveDispatch, RM, schedulers::PreemptivePolicy::RM)
+        ->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_GlobalDispatch, EDF, schedulers::GlobalPolicy::EDF)
+        ->ArgsProduct({{100, 1000, 10000}, {1, 16, 64}})->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_GlobalDispatch, EDZL, schedulers::GlobalPolicy::EDZL)
+        ->ArgsProduct({{100, 1000, 10000}, {1, 16, 64}})->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_PartitionTasks, RM, analysis::AcceptanceTest::RM)
+        ->ArgsProduct({{100, 1000, 10000}, {16, 64}})->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PartitionTasks, EDF, analysis::AcceptanceTest::EDF)
+        ->ArgsProduct({{100, 1000, 10000}, {16, 64}})->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_PreemptiveDispatchWithMetrics)
+        ->RangeMultiplier(10)->Range(bench::MIN_TASKS, bench::MAX_TASKS)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_TableDrivenDispatch)->RangeMultiplier(10)->Range(bench::MIN_TASKS, MAX_SCAN_TASKS);
+BENCHMARK(BM_CyclicExecutiveDispatch)->RangeMultiplier(10)->Range(bench::MIN_TASKS, MAX_SCAN_TASKS);
+BENCHMARK(BM_CreateFrames)->RangeMultiplier(10)->Range(bench::MIN_TASKS, MAX_SCAN_TASKS);
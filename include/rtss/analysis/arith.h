@@ -0,0 +1,49 @@
+#ifndef RTSS_ANALYSIS_ARITH_H
+#define RTSS_ANALYSIS_ARITH_H
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+namespace rtss::analysis {
+    // * Checked 64-bit arithmetic; each returns false if the result overflows.
+    inline bool checked_add(int64_t a, int64_t b, int64_t &out) noexcept {
+        return !__builtin_add_overflow(a, b, &out);
+    }
+
+    inline bool checked_mul(int64_t a, int64_t b, int64_t &out) noexcept {
+        return !__builtin_mul_overflow(a, b, &out);
+    }
+
+    inline bool checked_lcm(int64_t a, int64_t b, int64_t &out) noexcept {
+        if (a == 0 || b == 0) {
+            out = 0;
+            return true;
+        }
+        return checked_mul(a / std::gcd(a, b), b, out);
+    }
+
+    // * Saturating variants: clamp to INT64_MAX instead of overflowing.
+    // * Only meant for non-negative operands.
+    inline int64_t sat_add(int64_t a, int64_t b) noexcept {
+        int64_t r;
+        return checked_add(a, b, r) ? r : std::numeric_limits<int64_t>::max();
+    }
+
+    inline int64_t sat_mul(int64_t a, int64_t b) noexcept {
+        int64_t r;
+        return checked_mul(a, b, r) ? r : std::numeric_limits<int64_t>::max();
+    }
+
+    // Ceiling of a / b for a >= 0, b > 0.
+    inline int64_t ceil_div(int64_t a, int64_t b) noexcept {
+        return a / b + (a % b != 0);
+    }
+
+    // Floor of a / b for b > 0 and any sign of a.
+    inline int64_t floor_div(int64_t a, int64_t b) noexcept {
+        return a / b - (a % b != 0 && a < 0);
+    }
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef RTSS_ANALYSIS_FRAMES_H
+#define RTSS_ANALYSIS_FRAMES_H
+
+#include <functional>
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/time.h"
+
+namespace rtss::analysis {
+    // Lower is better.
+    using FrameCost = std::function<double(time::TimeDuration frame_sz, time::TimeDuration hyperperiod)>;
+
+    // Default cost: number of frames per hyperperiod.
+    inline double fewest_frames(time::TimeDuration frame_sz, time::TimeDuration hyperperiod) {
+        return static_cast<double>(hyperperiod / frame_sz);
+    }
+
+    struct FrameSizeSelection {
+        time::TimeDuration hyperperiod{time::ZERO_DURATION};
+        // Every valid frame size, in ascending order.
+        std::vector<time::TimeDuration> candidates;
+        // Candidate with the lowest cost; zero if there is none.
+        time::TimeDuration best{time::ZERO_DURATION};
+
+        [[nodiscard]] bool found() const noexcept { return best != time::ZERO_DURATION; }
+    };
+
+    // Frame sizes f of the periodic tasks that satisfy the cyclic executive constraints:
+    //   f >= max e_i,   f divides H,   2f - gcd(f, p_i) <= D_i for every task.
+    // The divisors of H are generated from the prime factorisation of the periods, and the
+    // candidates are checked on `nthreads` threads (0 = hardware concurrency).
+    // Throws std::overflow_error if the hyperperiod does not fit into time::TimeDuration.
+    FrameSizeSelection select_frame_size(const std::vector<Task *> &tasks, const FrameCost &cost = fewest_frames,
+                                         size_t nthreads = 0);
+}
+
+#endif
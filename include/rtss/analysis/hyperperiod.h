@@ -0,0 +1,19 @@
+#ifndef RTSS_ANALYSIS_HYPERPERIOD_H
+#define RTSS_ANALYSIS_HYPERPERIOD_H
+
+#include <vector>
+
+#include "rtss/analysis/arith.h"
+#include "rtss/task.h"
+#include "rtss/taskset.h"
+#include "rtss/time.h"
+
+namespace rtss::analysis {
+    // LCM of the periods of all periodic tasks; zero if there are none.
+    // Throws std::overflow_error if it does not fit into time::TimeDuration.
+    time::TimeDuration hyperperiod(const std::vector<Task *> &tasks);
+
+    time::TimeDuration hyperperiod(const TaskSet &task_set);
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef RTSS_ANALYSIS_PARTITION_H
+#define RTSS_ANALYSIS_PARTITION_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rtss/task.h"
+
+namespace rtss::analysis {
+    // Order in which the cores are tried for a task. The *_DECREASING variants place the
+    // tasks by decreasing utilisation instead of in list order.
+    enum class FitHeuristic {
+        FIRST_FIT, // lowest-numbered core that accepts the task
+        BEST_FIT, // most utilised core that accepts it
+        WORST_FIT, // least utilised core that accepts it
+        FIRST_FIT_DECREASING,
+        BEST_FIT_DECREASING,
+        WORST_FIT_DECREASING
+    };
+
+    // Schedulability test that decides whether a core accepts a task.
+    enum class AcceptanceTest {
+        RM, // response_time_analysis() with rate-monotonic priorities
+        DM, // response_time_analysis() with deadline-monotonic priorities
+        EDF // qpa_edf()
+    };
+
+    [[nodiscard]] const char *to_string(FitHeuristic heuristic) noexcept;
+
+    [[nodiscard]] const char *to_string(AcceptanceTest test) noexcept;
+
+    struct Partition {
+        static constexpr size_t UNASSIGNED = SIZE_MAX;
+
+        // Every task was placed.
+        bool feasible{false};
+        // Core of each task, indexed as the task list; UNASSIGNED if no core accepted it.
+        std::vector<size_t> core_of;
+        // Task indices on each core, in task-list order.
+        std::vector<std::vector<size_t> > tasks_on;
+        std::vector<double> utilisation;
+        size_t unassigned{0};
+        // Exact tests run; candidates decided by a utilisation bound are not counted.
+        size_t exact_tests{0};
+
+        // One line per core, e.g. "core 0: T1 T4 (U = 0.625)", and the tasks left over.
+        [[nodiscard]] std::string to_string(const std::vector<Task *> &tasks) const;
+    };
+
+    // Assigns each periodic task to one of `ncores` cores, each scheduled on its own.
+    // A core accepts a task if the tasks already on it and the new one pass `test`. Utilisation
+    // settles the easy cases first: a core never accepts more than U = 1, and for implicit
+    // deadlines EDF accepts up to U = 1 and RM below the hyperbolic bound prod(U_i + 1) <= 2,
+    // so the exact test runs only in between. Tasks no core accepts are left unassigned and
+    // the rest are still placed.
+    // * Throws if `ncores` is zero or a task is not periodic.
+    Partition partition_tasks(const std::vector<Task *> &tasks, size_t ncores, FitHeuristic heuristic,
+                              AcceptanceTest test);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef RTSS_ANALYSIS_QPA_H
+#define RTSS_ANALYSIS_QPA_H
+
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/time.h"
+
+namespace rtss::analysis {
+    struct QPAResult {
+        bool feasible{true};
+        // The test runs on the synchronous arrangement (all phases zero), which is the worst
+        // case for any phases. If the tasks have different phases and the test fails,
+        // the phased set may still be feasible and `exact` is false.
+        bool exact{true};
+        long double utilisation{0};
+        // Length t of an interval [0, t) whose demand exceeds t; zero if feasible.
+        time::TimeDuration failure_point{time::ZERO_DURATION};
+        // Demand-bound evaluations performed.
+        size_t iterations{0};
+    };
+
+    // Demand bound function of the synchronous arrangement: total execution of the jobs
+    // released and due within [0, t), i.e. sum_i max(0, floor((t - D_i) / T_i) + 1) C_i.
+    // Saturates instead of overflowing.
+    time::TimeDuration demand_bound(const std::vector<Task *> &tasks, time::TimeDuration t);
+
+    // Exact EDF feasibility test for periodic tasks with arbitrary (incl. constrained) deadlines,
+    // using Quick Processor-demand Analysis (Zhang & Burns): starting from the largest absolute
+    // deadline below the bound L, t steps backwards to h(t) or to the previous deadline,
+    // so only a few deadlines are visited instead of all of those up to the hyperperiod.
+    // Aperiodic tasks have no deadline and are ignored.
+    QPAResult qpa_edf(const std::vector<Task *> &tasks);
+}
+
+#endif
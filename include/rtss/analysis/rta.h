@@ -0,0 +1,45 @@
+#ifndef RTSS_ANALYSIS_RTA_H
+#define RTSS_ANALYSIS_RTA_H
+
+#include <cstdint>
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/time.h"
+
+namespace rtss::analysis {
+    // Per-task terms of the analysis, indexed as the task list.
+    // An empty vector means zero for every task.
+    struct RTAParams {
+        std::vector<time::TimeDuration> release_jitter;
+        std::vector<time::TimeDuration> blocking;
+        // Stop at the first task that misses its deadline instead of analysing the rest.
+        bool stop_at_first_miss{true};
+    };
+
+    struct RTAResult {
+        bool schedulable{true};
+        // Worst-case response time of each task, indexed as the task list.
+        // UNBOUNDED if the task misses its deadline or was not analysed;
+        // aperiodic tasks are not analysed and keep zero.
+        std::vector<time::TimeDuration> response_tm;
+        // First task (in priority order) that misses its deadline; SIZE_MAX if none.
+        size_t first_miss{SIZE_MAX};
+        // Fixed-point iterations performed, over all tasks.
+        size_t iterations{0};
+
+        static constexpr time::TimeDuration UNBOUNDED = time::TimeDuration::max();
+    };
+
+    // Exact response time analysis for preemptive fixed-priority scheduling:
+    //   w = B_i + (q+1) C_i + sum_{j in hp(i)} ceil((w + J_j) / T_j) C_j,   R_i = max_q (w - q T_i + J_i)
+    // `pri_idx` lists task indices from highest priority to lowest, as given by
+    // PriorityBasedScheduler::get_priority_order(). Arbitrary deadlines are handled by
+    // examining every job of the level-i busy period (q > 0 is only needed when D_i > T_i).
+    // Each task's iteration starts from the previous task's busy window, and it stops
+    // as soon as the response time exceeds the deadline.
+    RTAResult response_time_analysis(const std::vector<Task *> &tasks, const std::vector<size_t> &pri_idx,
+                                     const RTAParams &params = {});
+}
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef RTSS_CLOCK_H
+#define RTSS_CLOCK_H
+
+#include <thread>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#endif
+
+#include "rtss/time.h"
+
+namespace rtss::time {
+    // Time source the schedulers run against.
+    // now() is the time elapsed since the start of the run (the last reset()).
+    // advance()/advance_until() move it forward: RealClock actually waits,
+    // VirtualClock jumps straight to the target, so a run takes no wall-clock time.
+    class SimClock {
+    public:
+        virtual ~SimClock() = default;
+
+        virtual void reset() = 0;
+
+        [[nodiscard]] virtual TimeDuration now() const = 0;
+
+        virtual void advance(TimeDuration d) = 0;
+
+        virtual void advance_until(TimeDuration t) = 0;
+
+        [[nodiscard]] virtual bool is_virtual() const noexcept = 0;
+    };
+
+    // Sleeps until the absolute instant `t`. On Linux this is a single
+    // clock_nanosleep(TIMER_ABSTIME) on the clock behind steady_clock, so no time passes
+    // between reading the clock and starting to sleep.
+    inline void sleep_until(TimePoint t) {
+#if defined(__linux__)
+        const auto since_epoch = t.time_since_epoch();
+        if (since_epoch < Clock::duration::zero()) return;
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(std::chrono::duration_cast<std::chrono::seconds>(since_epoch).count());
+        ts.tv_nsec = static_cast<long>((since_epoch - std::chrono::seconds(ts.tv_sec)).count());
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+        }
+#else
+        std::this_thread::sleep_until(t);
+#endif
+    }
+
+    // Hint to the CPU that the thread is busy-waiting.
+    inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // How long before a deadline precise_sleep_until() stops sleeping and starts to spin.
+    // Calibrated on the first call from the wake-up overshoot of a few short sleeps
+    // (a high percentile plus a margin), then fixed for the process.
+    Clock::duration spin_guard();
+
+    // Sleeps until spin_guard() before `t` and spins on steady_clock for the rest, so it wakes
+    // up within a few microseconds of `t` while a long wait still sleeps most of the time.
+    void precise_sleep_until(TimePoint t);
+
+    // How RealClock waits.
+    enum class WaitMode {
+        SLEEP, // sleep_until(): no CPU use, wakes up as late as the kernel's timer slack
+        HYBRID // precise_sleep_until(): spins for the last spin_guard() of every wait
+    };
+
+    // Wall-clock time, anchored at the epoch taken by reset().
+    // Every wait is for an absolute instant computed from the epoch, never a relative sleep:
+    // advance(d) waits until d after the instant the last wait was for, not d after now,
+    // so the overshoot of one wake-up does not push back the next and a run does not drift.
+    class RealClock : public SimClock {
+    public:
+        // * HYBRID calibrates spin_guard() here if it has not been yet, not in the first wait.
+        explicit RealClock(WaitMode mode = WaitMode::SLEEP) : _epoch(Clock::now()), _mode(mode) {
+            if (mode == WaitMode::HYBRID) {
+                spin_guard();
+            }
+        }
+
+        void reset() override {
+            _epoch = Clock::now();
+            _target = ZERO_DURATION;
+        }
+
+        [[nodiscard]] TimeDuration now() const override { return from_clock(Clock::now() - _epoch); }
+
+        void advance(TimeDuration d) override { advance_until(_target + d); }
+
+        void advance_until(TimeDuration t) override {
+            if (t > _target) {
+                _target = t;
+            }
+            if (_mode == WaitMode::HYBRID) {
+                precise_sleep_until(_epoch + _target);
+            } else {
+                time::sleep_until(_epoch + _target);
+            }
+        }
+
+        [[nodiscard]] bool is_virtual() const noexcept override { return false; }
+
+        [[nodiscard]] WaitMode wait_mode() const noexcept { return _mode; }
+
+    private:
+        TimePoint _epoch;
+        // Instant the last wait was for.
+        TimeDuration _target{ZERO_DURATION};
+        WaitMode _mode;
+    };
+
+    class VirtualClock : public SimClock {
+    public:
+        void reset() override { _now = ZERO_DURATION; }
+
+        [[nodiscard]] TimeDuration now() const override { return _now; }
+
+        void advance(TimeDuration d) override { _now += d; }
+
+        void advance_until(TimeDuration t) override {
+            if (t > _now) {
+                _now = t;
+            }
+        }
+
+        [[nodiscard]] bool is_virtual() const noexcept override { return true; }
+
+    private:
+        TimeDuration _now{ZERO_DURATION};
+    };
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef RTSS_CONTAINERS_INDEXED_HEAP_H
+#define RTSS_CONTAINERS_INDEXED_HEAP_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace rtss::containers {
+    // Binary min-heap over the item indices [0, capacity), each with its own key.
+    // Every item is in the heap at most once and its position is tracked,
+    // so erase() and update() (decrease- or increase-key) are O(log n).
+    // Ties are broken by the lower index to keep the order deterministic.
+    template<typename Key>
+    class IndexedHeap {
+    public:
+        explicit IndexedHeap(size_t capacity = 0) { reset(capacity); }
+
+        // Empty the heap and make room for `capacity` items.
+        void reset(size_t capacity) {
+            _heap.clear();
+            _heap.reserve(capacity);
+            _pos.assign(capacity, NPOS);
+            _key.resize(capacity);
+        }
+
+        [[nodiscard]] bool empty() const noexcept { return _heap.empty(); }
+
+        [[nodiscard]] size_t size() const noexcept { return _heap.size(); }
+
+        [[nodiscard]] bool contains(size_t i) const noexcept { return i < _pos.size() && _pos[i] != NPOS; }
+
+        [[nodiscard]] size_t top() const {
+            if (_heap.empty()) {
+                throw std::out_of_range("[IndexedHeap::top] Heap is empty");
+            }
+            return _heap[0];
+        }
+
+        [[nodiscard]] const Key &key(size_t i) const noexcept { return _key[i]; }
+
+        void push(size_t i, const Key &k) {
+            if (contains(i)) {
+                throw std::runtime_error("[IndexedHeap::push] Item is already in the heap");
+            }
+            _key[i] = k;
+            _pos[i] = _heap.size();
+            _heap.push_back(i);
+            sift_up(_pos[i]);
+        }
+
+        void pop() { erase(top()); }
+
+        void erase(size_t i) {
+            if (!contains(i)) {
+                throw std::runtime_error("[IndexedHeap::erase] Item is not in the heap");
+            }
+            size_t p = _pos[i];
+            size_t last = _heap.back();
+            _heap.pop_back();
+            _pos[i] = NPOS;
+            if (last != i) {
+                _heap[p] = last;
+                _pos[last] = p;
+                sift_up(p);
+                sift_down(_pos[last]);
+            }
+        }
+
+        // Change the key of an item already in the heap, in either direction.
+        void update(size_t i, const Key &k) {
+            if (!contains(i)) {
+                throw std::runtime_error("[IndexedHeap::update] Item is not in the heap");
+            }
+            _key[i] = k;
+            sift_up(_pos[i]);
+            sift_down(_pos[i]);
+        }
+
+    private:
+        static constexpr size_t NPOS = SIZE_MAX;
+
+        std::vector<size_t> _heap; // heap-ordered item indices
+        std::vector<size_t> _pos; // item index -> position in _heap
+        std::vector<Key> _key;
+
+        [[nodiscard]] bool less(size_t a, size_t b) const noexcept {
+            return _key[a] < _key[b] || (!(_key[b] < _key[a]) && a < b);
+        }
+
+        void place(size_t p, size_t i) noexcept {
+            _heap[p] = i;
+            _pos[i] = p;
+        }
+
+        void sift_up(size_t p) noexcept {
+            size_t i = _heap[p];
+            while (p > 0) {
+                size_t parent = (p - 1) / 2;
+                if (!less(i, _heap[parent])) break;
+                place(p, _heap[parent]);
+                p = parent;
+            }
+            place(p, i);
+        }
+
+        void sift_down(size_t p) noexcept {
+            const size_t n = _heap.size();
+            size_t i = _heap[p];
+            while (true) {
+                size_t child = 2 * p + 1;
+                if (child >= n) break;
+                if (child + 1 < n && less(_heap[child + 1], _heap[child])) {
+                    child++;
+                }
+                if (!less(_heap[child], i)) break;
+                place(p, _heap[child]);
+                p = child;
+            }
+            place(p, i);
+        }
+    };
+}
+
+#endif
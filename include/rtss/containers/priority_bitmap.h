@@ -0,0 +1,86 @@
+#ifndef RTSS_CONTAINERS_PRIORITY_BITMAP_H
+#define RTSS_CONTAINERS_PRIORITY_BITMAP_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace rtss::containers {
+    // Set of ready priority levels, 0 being the highest priority.
+    // Like an RTOS ready bitmap, but hierarchical: bit i of a layer says whether
+    // word i of the layer below has any bit set, so the highest ready level is
+    // found with one find-first-set per layer (3 layers cover 262144 levels).
+    class PriorityBitmap {
+    public:
+        explicit PriorityBitmap(size_t nlevels = 0) { reset(nlevels); }
+
+        // Clear all levels and make room for `nlevels` of them.
+        void reset(size_t nlevels) {
+            _nlevels = nlevels;
+            _layers.clear();
+            size_t nbits = nlevels > 0 ? nlevels : 1;
+            do {
+                size_t nwords = (nbits + WORD_BITS - 1) / WORD_BITS;
+                _layers.emplace_back(nwords, 0);
+                nbits = nwords;
+            } while (nbits > 1);
+        }
+
+        [[nodiscard]] size_t levels() const noexcept { return _nlevels; }
+
+        [[nodiscard]] bool empty() const noexcept { return _layers.back()[0] == 0; }
+
+        [[nodiscard]] bool test(size_t level) const {
+            check(level, "[PriorityBitmap::test] Level out of range");
+            return (_layers[0][level / WORD_BITS] >> (level % WORD_BITS)) & 1u;
+        }
+
+        void set(size_t level) {
+            check(level, "[PriorityBitmap::set] Level out of range");
+            for (auto &layer: _layers) {
+                uint64_t &word = layer[level / WORD_BITS];
+                bool was_empty = word == 0;
+                word |= uint64_t{1} << (level % WORD_BITS);
+                if (!was_empty) break;
+                level /= WORD_BITS;
+            }
+        }
+
+        void clear(size_t level) {
+            check(level, "[PriorityBitmap::clear] Level out of range");
+            for (auto &layer: _layers) {
+                uint64_t &word = layer[level / WORD_BITS];
+                word &= ~(uint64_t{1} << (level % WORD_BITS));
+                if (word != 0) break;
+                level /= WORD_BITS;
+            }
+        }
+
+        // Highest-priority (lowest) level that is set.
+        [[nodiscard]] size_t first() const {
+            if (empty()) {
+                throw std::out_of_range("[PriorityBitmap::first] Bitmap is empty");
+            }
+            size_t level = 0;
+            for (size_t k = _layers.size(); k-- > 0;) {
+                level = level * WORD_BITS + __builtin_ctzll(_layers[k][level]);
+            }
+            return level;
+        }
+
+    private:
+        static constexpr size_t WORD_BITS = 64;
+
+        size_t _nlevels{0};
+        // _layers[0] holds one bit per level, _layers.back() is a single word.
+        std::vector<std::vector<uint64_t> > _layers;
+
+        void check(size_t level, const char *msg) const {
+            if (level >= _nlevels) {
+                throw std::out_of_range(msg);
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef RTSS_CONTAINERS_SLAB_POOL_H
+#define RTSS_CONTAINERS_SLAB_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rtss::containers {
+    // Recycling allocator for objects of one type.
+    // Objects live in slabs that are never given back before the pool is destroyed, and a
+    // released object goes on a free list that the next acquire() takes from. Once the pool
+    // has grown to the largest number of objects alive at a time, acquire() and release()
+    // are a few pointer moves and never reach the global allocator.
+    // Each new slab is twice the size of the last, so a pool of n objects has O(log n) slabs.
+    // Slots are reused without running destructors, so T must be trivially destructible.
+    template<typename T>
+    class SlabPool {
+        static_assert(std::is_trivially_destructible_v<T>, "SlabPool does not run destructors");
+
+    public:
+        // * `first_slab` is the number of objects the first slab holds.
+        explicit SlabPool(size_t first_slab = 64) : _next_slab(first_slab > 0 ? first_slab : 1) {
+        }
+
+        SlabPool(const SlabPool &) = delete;
+
+        SlabPool &operator=(const SlabPool &) = delete;
+
+        SlabPool(SlabPool &&) noexcept = default;
+
+        SlabPool &operator=(SlabPool &&) noexcept = default;
+
+        // Constructs an object in a free slot, adding a slab if there is none.
+        template<typename... Args>
+        [[nodiscard]] T *acquire(Args &&... args) {
+            if (__builtin_expect(_free == nullptr, 0)) grow();
+            Slot *s = _free;
+            _free = s->next;
+            _in_use++;
+            return ::new(static_cast<void *>(s->storage)) T(std::forward<Args>(args)...);
+        }
+
+        // * `p` must come from acquire() on this pool and not have been released since.
+        void release(T *p) noexcept {
+            auto *s = reinterpret_cast<Slot *>(p);
+            s->next = _free;
+            _free = s;
+            _in_use--;
+        }
+
+        // Number of objects acquired and not released.
+        [[nodiscard]] size_t in_use() const noexcept { return _in_use; }
+
+        // Number of objects the slabs hold.
+        [[nodiscard]] size_t capacity() const noexcept { return _capacity; }
+
+        [[nodiscard]] size_t nslabs() const noexcept { return _slabs.size(); }
+
+    private:
+        union Slot {
+            Slot *next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        std::vector<std::unique_ptr<Slot[]> > _slabs;
+        Slot *_free{nullptr};
+        size_t _next_slab;
+        size_t _capacity{0};
+        size_t _in_use{0};
+
+        __attribute__((noinline)) void grow() {
+            const size_t n = _next_slab;
+            _slabs.push_back(std::make_unique<Slot[]>(n));
+            Slot *slab = _slabs.back().get();
+            for (size_t k = 0; k < n; k++) {
+                slab[k].next = k + 1 < n ? &slab[k + 1] : _free;
+            }
+            _free = slab;
+            _capacity += n;
+            _next_slab = 2 * n;
+        }
+    };
+}
+
+#endif
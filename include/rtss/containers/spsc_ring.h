@@ -0,0 +1,77 @@
+#ifndef RTSS_CONTAINERS_SPSC_RING_H
+#define RTSS_CONTAINERS_SPSC_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace rtss::containers {
+    // Bounded lock-free queue for one producer thread and one consumer thread.
+    // Each side owns one index and only reads the other's, so a push or a pop is a
+    // plain copy plus one release store. The indices sit on separate cache lines and the
+    // producer caches the consumer's index, so a push rarely touches the shared line.
+    template<typename T>
+    class SpscRing {
+        static_assert(std::is_trivially_copyable_v<T>, "SpscRing copies items with plain assignment");
+
+    public:
+        // * `capacity` is rounded up to a power of two.
+        explicit SpscRing(size_t capacity) {
+            if (capacity == 0) {
+                throw std::runtime_error("[SpscRing::SpscRing] Capacity cannot be zero");
+            }
+            size_t cap = 1;
+            while (cap < capacity) cap <<= 1;
+            _mask = cap - 1;
+            _items = std::make_unique<T[]>(cap);
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept { return _mask + 1; }
+
+        // Producer side. Returns false if the ring is full.
+        bool try_push(const T &item) noexcept {
+            const size_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail - _head_cache > _mask) {
+                _head_cache = _head.load(std::memory_order_acquire);
+                if (tail - _head_cache > _mask) return false;
+            }
+            _items[tail & _mask] = item;
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. Moves up to `max` items into `out` and returns how many.
+        size_t pop(T *out, size_t max) noexcept {
+            const size_t head = _head.load(std::memory_order_relaxed);
+            // One load per batch, so unlike the producer the consumer needs no cached index.
+            const size_t tail = _tail.load(std::memory_order_acquire);
+            size_t n = std::min(max, tail - head);
+            for (size_t k = 0; k < n; k++) {
+                out[k] = _items[(head + k) & _mask];
+            }
+            if (n > 0) _head.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+        // Consumer side; exact when the producer is idle.
+        [[nodiscard]] bool empty() const noexcept {
+            return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        static constexpr size_t CACHE_LINE = 64;
+
+        std::unique_ptr<T[]> _items;
+        size_t _mask{0};
+        // Written by the consumer.
+        alignas(CACHE_LINE) std::atomic<size_t> _head{0};
+        // Written by the producer.
+        alignas(CACHE_LINE) std::atomic<size_t> _tail{0};
+        size_t _head_cache{0};
+    };
+}
+
+#endif
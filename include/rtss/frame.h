@@ -1,8 +1,11 @@
 #ifndef RTSS_FRAME_H
 #define RTSS_FRAME_H
 
+#include <utility>
 #include <vector>
 
+#include "rtss/logging/event_log.h"
+#include "rtss/schedulers/observer.h"
 #include "rtss/task.h"
 
 namespace rtss {
@@ -13,7 +16,7 @@ namespace rtss {
 
         [[nodiscard]] std::string to_string() const {
             std::ostringstream oss;
-            oss << "{T" << task_id << ", " << time::toInt(exec_tm) << "ms}";
+            oss << "{T" << task_id << ", " << time::to_string(exec_tm) << "}";
             return oss.str();
         }
 
@@ -23,12 +26,18 @@ namespace rtss {
 
     class Frame {
     public:
-        explicit Frame(const std::vector<FrameJob> &&jobs)
-            : _jobs(jobs) {
+        explicit Frame(std::vector<FrameJob> &&jobs)
+            : _jobs(std::move(jobs)) {
         }
 
         void run_frame(const std::vector<Task *> &tasks_ref) const;
 
+        // * Jobs are logged to `logger`; nullptr runs the frame silently.
+        // * Each job is reported to `observers` as a dispatch on core 0.
+        void run_frame(const std::vector<Task *> &tasks_ref, time::SimClock &clock,
+                       logging::EventLogger *logger = &logging::EventLogger::global(),
+                       const std::vector<schedulers::SchedulerObserver *> &observers = {}) const;
+
         [[nodiscard]] std::string to_string() const {
             std::string result;
             for (auto &fj: _jobs) {
@@ -44,10 +53,9 @@ namespace rtss {
 
     class FrameContainer {
     public:
-        explicit FrameContainer(const std::vector<Task *> &tasks_ref, const std::vector<Frame> &&frames,
+        explicit FrameContainer(const std::vector<Task *> &tasks_ref, std::vector<Frame> &&frames,
                                 time::TimeDuration frame_tm_dur)
-            : _frames(frames), _tasks_ref(const_cast<std::vector<Task *> &>(tasks_ref)),
-              _frame_tm_dur(frame_tm_dur) {
+            : _tasks_ref(tasks_ref), _frames(std::move(frames)), _frame_tm_dur(frame_tm_dur) {
         }
 
         void run_frame(size_t k) {
@@ -57,6 +65,13 @@ namespace rtss {
             _frames[k].run_frame(_tasks_ref);
         }
 
+        void run_frame(size_t k, time::SimClock &clock, logging::EventLogger *logger = &logging::EventLogger::global()) {
+            if (k >= _frames.size()) {
+                throw std::out_of_range("[FrameContainer::run_frame] Index out of range");
+            }
+            _frames[k].run_frame(_tasks_ref, clock, logger);
+        }
+
         [[nodiscard]] std::string to_string() const {
             std::string result;
             for (size_t i = 0; i < _frames.size(); ++i) {
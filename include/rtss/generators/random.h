@@ -0,0 +1,62 @@
+#ifndef RTSS_GENERATORS_RANDOM_H
+#define RTSS_GENERATORS_RANDOM_H
+
+#include <cstdint>
+#include <limits>
+
+namespace rtss::generators {
+    // xoshiro256** (Blackman & Vigna), seeded through splitmix64.
+    // Small, fast and identical on every platform, unlike the std:: distributions,
+    // so a seed always reproduces the same task sets.
+    // Satisfies UniformRandomBitGenerator, so it also works with <random> and std::shuffle.
+    class Rng {
+    public:
+        using result_type = uint64_t;
+
+        explicit Rng(uint64_t seed = 0) { this->seed(seed); }
+
+        void seed(uint64_t seed) noexcept {
+            for (auto &s: _s) {
+                seed += 0x9e3779b97f4a7c15ULL;
+                uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                s = z ^ (z >> 31);
+            }
+        }
+
+        static constexpr result_type min() noexcept { return 0; }
+
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() noexcept {
+            const uint64_t result = rotl(_s[1] * 5, 7) * 9;
+            const uint64_t t = _s[1] << 17;
+            _s[2] ^= _s[0];
+            _s[3] ^= _s[1];
+            _s[1] ^= _s[2];
+            _s[0] ^= _s[3];
+            _s[2] ^= t;
+            _s[3] = rotl(_s[3], 45);
+            return result;
+        }
+
+        // Uniform in [0, 1).
+        double uniform() noexcept { return static_cast<double>((*this)() >> 11) * 0x1.0p-53; }
+
+        double uniform(double a, double b) noexcept { return a + (b - a) * uniform(); }
+
+        // Uniform in [0, n), n > 0 (Lemire's multiply-shift, without the rejection step;
+        // the bias is below 2^-64 * n).
+        uint64_t below(uint64_t n) noexcept {
+            return static_cast<uint64_t>((static_cast<unsigned __int128>((*this)()) * n) >> 64);
+        }
+
+    private:
+        uint64_t _s[4]{};
+
+        static uint64_t rotl(uint64_t x, int k) noexcept { return (x << k) | (x >> (64 - k)); }
+    };
+}
+
+#endif
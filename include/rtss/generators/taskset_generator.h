@@ -0,0 +1,94 @@
+#ifndef RTSS_GENERATORS_TASKSET_GENERATOR_H
+#define RTSS_GENERATORS_TASKSET_GENERATOR_H
+
+#include <cstdint>
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/taskset.h"
+#include "rtss/generators/random.h"
+
+namespace rtss::generators {
+    enum class UtilisationMethod { UUNIFAST, UUNIFAST_DISCARD, RANDFIXEDSUM };
+
+    enum class PeriodDistribution {
+        // Uniform in log space over [period_min_ms, period_max_ms], rounded down to
+        // a multiple of period_granularity_ms (Emberson, Stafford & Davis, 2010).
+        LOG_UNIFORM,
+        // period_min_ms * 2^k, so every period divides the longest one.
+        HARMONIC,
+        // Divisors of hyperperiod_bound_ms within [period_min_ms, period_max_ms],
+        // so the hyperperiod never exceeds the bound.
+        BOUNDED_HYPERPERIOD
+    };
+
+    struct GeneratorParams {
+        size_t nperiodic{10};
+        // Sum of the periodic task utilisations.
+        double utilisation{0.7};
+        UtilisationMethod method{UtilisationMethod::UUNIFAST_DISCARD};
+
+        PeriodDistribution periods{PeriodDistribution::LOG_UNIFORM};
+        int64_t period_min_ms{10};
+        int64_t period_max_ms{1000};
+        int64_t period_granularity_ms{1};
+        // 2^5 * 3^2 * 5^2 * 7 * 11
+        int64_t hyperperiod_bound_ms{554400};
+
+        // D = C + r * (T - C), with r uniform in [dl_ratio_min, dl_ratio_max]:
+        // 1 gives implicit deadlines, below 1 constrained ones, above 1 arbitrary ones.
+        double dl_ratio_min{1.0};
+        double dl_ratio_max{1.0};
+
+        // Phases uniform in [0, T) on whole milliseconds; otherwise all tasks start at 0.
+        bool random_phases{false};
+
+        // Aperiodic tasks appended after the periodic ones, with arrival times uniform
+        // in [0, aperiodic_arrival_max_ms) and WCETs uniform in [aperiodic_wcet_min_ms, aperiodic_wcet_max_ms].
+        size_t naperiodic{0};
+        int64_t aperiodic_arrival_max_ms{1000};
+        int64_t aperiodic_wcet_min_ms{1};
+        int64_t aperiodic_wcet_max_ms{10};
+    };
+
+    // Synthetic task-set generator, deterministic from its seed:
+    // the same seed and the same sequence of calls give the same task sets.
+    // Task sets are written into a TaskSet (one array per parameter) and the scratch buffers
+    // are kept between calls, so a warm generator does not allocate per task.
+    // WCETs are kept at tick resolution so that utilisations are not rounded to whole milliseconds.
+    class TaskSetGenerator {
+    public:
+        explicit TaskSetGenerator(uint64_t seed) : _rng(seed) {
+        }
+
+        // Replace the contents of `out` with a new task set.
+        void generate(const GeneratorParams &params, TaskSet &out);
+
+        [[nodiscard]] Rng &rng() noexcept { return _rng; }
+
+    private:
+        Rng _rng;
+        std::vector<double> _utilisation;
+        std::vector<double> _rfs_table;
+        std::vector<int64_t> _divisors;
+        int64_t _divisors_key[3]{0, 0, 0};
+
+        void check(const GeneratorParams &params) const;
+
+        int64_t draw_period_ms(const GeneratorParams &params);
+    };
+
+    // Task objects for a generated TaskSet, for the schedulers that take std::vector<Task *>.
+    // All tasks live in two contiguous arrays and `tasks` points into them in TaskSet order.
+    // Tasks take their ids from the TaskSet; TaskSetGenerator numbers them 1, 2, ... while
+    // those fit into the 16-bit task id, and later ones keep id 0.
+    struct TaskStorage {
+        std::vector<PeriodicTask> periodic;
+        std::vector<AperiodicTask> aperiodic;
+        std::vector<Task *> tasks;
+    };
+
+    void make_tasks(const TaskSet &task_set, TaskStorage &storage);
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RTSS_GENERATORS_UTILISATION_H
+#define RTSS_GENERATORS_UTILISATION_H
+
+#include <cstddef>
+#include <vector>
+
+#include "rtss/generators/random.h"
+
+namespace rtss::generators {
+    // Per-task utilisations summing to `total`, drawn uniformly from the valid region.
+    // All of them overwrite `out` with n values and allocate nothing once `out` has the capacity.
+
+    // UUniFast (Bini & Buttazzo, 2005): uniform over the simplex, O(n).
+    // Values can exceed 1 when total > 1.
+    void uunifast(Rng &rng, size_t n, double total, std::vector<double> &out);
+
+    // UUniFast-Discard (Davis & Burns, 2009): UUniFast, redrawn until every value is at most 1.
+    // Throws std::runtime_error after `max_attempts` rejected draws (the acceptance rate
+    // drops quickly as total approaches n).
+    void uunifast_discard(Rng &rng, size_t n, double total, std::vector<double> &out, size_t max_attempts = 1000);
+
+    // Stafford's RandFixedSum, as used by Emberson, Stafford & Davis (2010): uniform over
+    // the values in [0, 1] that sum to `total`, without rejection.
+    // Its table has floor(total) + 1 columns per task, so it is O(n) for total <= 1.
+    // `table` is scratch space that can be reused between calls.
+    void randfixedsum(Rng &rng, size_t n, double total, std::vector<double> &out, std::vector<double> &table);
+}
+
+#endif
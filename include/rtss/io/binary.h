@@ -0,0 +1,93 @@
+#ifndef RTSS_IO_BINARY_H
+#define RTSS_IO_BINARY_H
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "rtss/io/input.h"
+#include "rtss/task.h"
+#include "rtss/task_store.h"
+#include "rtss/tasktable.h"
+
+namespace rtss::io {
+    // Binary counterpart of the CSV formats, for inputs that are loaded over and over.
+    //
+    // A file is a BinaryHeader followed by `count` records in host byte order:
+    // - TASK_TABLE: TaskScheduleEntry as laid out in memory (start time in ticks, task id),
+    //   so a table can be mapped and used in place; or, with DELTA_TIMES, a varint of the
+    //   start time minus the previous one (in `time_unit_ns`) and a 2-byte task id per record.
+    // - TASK_LIST: BinaryTaskRecord.
+    // Writers store times in ticks of time::TimeDuration, and `time_unit_ns` is the tick.
+    // Readers accept any unit that is a whole number of their own ticks, except for a mapped
+    // fixed-width table, whose unit must be the tick itself.
+    constexpr char BINARY_MAGIC[8] = {'R', 'T', 'S', 'S', 'B', 'I', 'N', '\0'};
+    constexpr uint32_t BINARY_BYTE_ORDER_TAG = 0x01020304;
+    constexpr uint16_t BINARY_VERSION = 1;
+
+    enum class BinaryKind : uint16_t {
+        TASK_LIST = 1,
+        TASK_TABLE = 2
+    };
+
+    enum BinaryFlags : uint16_t {
+        DELTA_TIMES = 1 << 0
+    };
+
+    struct BinaryHeader {
+        char magic[8];
+        uint32_t byte_order; // BINARY_BYTE_ORDER_TAG as written by the producing machine
+        uint16_t version;
+        uint16_t kind; // BinaryKind
+        uint16_t flags; // BinaryFlags
+        uint16_t record_size; // 0 for variable-length records
+        uint32_t reserved;
+        uint64_t count;
+        uint64_t time_unit_ns; // times are stored as multiples of this
+    };
+
+    static_assert(sizeof(BinaryHeader) == 40, "BinaryHeader layout is part of the file format");
+
+    struct BinaryTaskRecord {
+        uint8_t type; // 'P' or 'A', as in the CSV task list
+        uint8_t reserved0;
+        uint16_t id;
+        uint32_t reserved1;
+        int64_t phase, period, wcet, rel_dl; // in `time_unit_ns`
+    };
+
+    static_assert(sizeof(BinaryTaskRecord) == 40, "BinaryTaskRecord layout is part of the file format");
+
+    // * Writes `tasks` (PeriodicTask and AperiodicTask only) with their ids.
+    void write_task_list_binary(const std::vector<Task *> &tasks, const std::filesystem::path &bin_path);
+
+    // * Same contract as read_task_list_from_csv(), except that ids come from the file.
+    void read_task_list_binary(std::vector<Task *> &tasks, const std::string &file_path, Metadata &meta);
+
+    void read_task_list_binary(TaskStore &store, const std::string &file_path, Metadata &meta);
+
+    // * `delta_times` trades the in-place use of load_task_table_binary() for a file several times smaller.
+    void write_task_table_binary(const TaskTableBuilder &tbl_builder, const std::filesystem::path &bin_path,
+                                 bool delta_times = false);
+
+    // * Decodes either table encoding into an empty builder.
+    void read_task_table_binary(TaskTableBuilder &tbl_builder, const std::string &file_path);
+
+    // Maps a schedule table and builds a TASK_BASED table on top of the mapping.
+    // Fixed-width files are used in place, so loading costs the same for any table size
+    // and pages are read on first access; DELTA_TIMES files are decoded into memory.
+    // Records are trusted: only the header and the file size are checked.
+    TaskTable load_task_table_binary(const std::string &file_path);
+
+    void convert_task_list_csv_to_binary(const std::string &csv_path, const std::filesystem::path &bin_path);
+
+    void convert_task_list_binary_to_csv(const std::string &bin_path, const std::filesystem::path &csv_path);
+
+    void convert_task_table_csv_to_binary(const std::string &csv_path, const std::filesystem::path &bin_path,
+                                          bool delta_times = false);
+
+    void convert_task_table_binary_to_csv(const std::string &bin_path, const std::filesystem::path &csv_path);
+}
+
+#endif
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "rtss/task.h"
+#include "rtss/task_store.h"
 #include "rtss/tasktable.h"
 
 namespace rtss::io {
@@ -12,15 +13,31 @@ namespace rtss::io {
         bool fully_periodic{false};
     };
 
+    //* Times are in milliseconds unless they carry a unit suffix: "ns", "us", "ms" or "s"
+    //* (e.g. "250us"). A time that is not a whole number of time::TimeDuration ticks is an error.
     void read_task_list_from_csv(std::vector<Task *> &tasks, const std::string &file_path, Metadata &meta);
 
+    // * Same, with the tasks owned by `store`, which has to be empty; see TaskStore.
+    void read_task_list_from_csv(TaskStore &store, const std::string &file_path, Metadata &meta);
+
     void read_task_list_from_csv(std::vector<PeriodicTask *> &periodic, std::vector<AperiodicTask *> &aperiodic,
                                  const std::string &file_path, Metadata &meta);
 
     //* In the CSV file
     //* '0' stands for Idle
     //* '-1' stands for "reset timer"
-    void read_task_table_from_csv(TaskTableBuilder &tbl_builder, const std::string &file_path);
+    //* Start times must not decrease from one line to the next; they take the same unit
+    //* suffixes as the task list.
+    // Large files are split at line boundaries and the pieces parsed on `nthreads` threads
+    // (0 = one per core); the entries still end up in file order.
+    void read_task_table_from_csv(TaskTableBuilder &tbl_builder, const std::string &file_path, size_t nthreads = 1);
+
+    // Writes `tasks` (PeriodicTask and AperiodicTask only) in the format read_task_list_from_csv() reads.
+    // Times are written in milliseconds, or with the coarsest unit suffix that is exact.
+    void write_task_list_csv(const std::vector<Task *> &tasks, const std::filesystem::path &csv_path);
+
+    // Writes the entries of `tbl_builder` in the format read_task_table_from_csv() reads.
+    void write_task_table_csv(const TaskTableBuilder &tbl_builder, const std::filesystem::path &csv_path);
 
     void write_task_csv_from_stdin(const std::filesystem::path &csv_path);
 
@@ -0,0 +1,39 @@
+#ifndef RTSS_IO_MAPPED_FILE_H
+#define RTSS_IO_MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+
+namespace rtss::io {
+    // Read-only memory mapping of a whole file.
+    // The parsers read straight from the page cache instead of copying the file
+    // through a stream buffer; an empty file maps to an empty view.
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string &file_path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        MappedFile(MappedFile &&other) noexcept;
+
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        [[nodiscard]] const char *data() const noexcept { return _data; }
+
+        [[nodiscard]] size_t size() const noexcept { return _size; }
+
+        [[nodiscard]] std::string_view view() const noexcept { return {_data, _size}; }
+
+    private:
+        const char *_data{nullptr};
+        size_t _size{0};
+
+        void unmap() noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef RTSS__JOB_H
+#define RTSS__JOB_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "rtss/containers/slab_pool.h"
+#include "rtss/time.h"
+
+namespace rtss {
+    // Absolute deadline of a job that has none: aperiodic jobs run in the background.
+    // Observers get it in on_release() and on_complete() too.
+    constexpr time::TimeDuration NO_DEADLINE = time::TimeDuration::max();
+
+    // One released instance of a task.
+    struct Job {
+        Job(size_t task_idx, uint64_t seq, time::TimeDuration release, time::TimeDuration abs_dl,
+            time::TimeDuration rem_tm) noexcept
+            : task_idx(task_idx), seq(seq), release(release), abs_dl(abs_dl), rem_tm(rem_tm) {
+        }
+
+        // Index of the task in the scheduler's task list.
+        size_t task_idx;
+        // 0 for the first job of the task in a run, 1 for the second, ...
+        uint64_t seq;
+        time::TimeDuration release, abs_dl, rem_tm;
+        // Next job in the JobQueue holding this one.
+        Job *next{nullptr};
+    };
+
+    // Jobs are created and retired at every release and completion, so they come from a
+    // pool that recycles them instead of from the global allocator.
+    using JobPool = containers::SlabPool<Job>;
+
+    // Jobs in release order, linked through Job::next; the queue does not own them.
+    class JobQueue {
+    public:
+        [[nodiscard]] bool empty() const noexcept { return _head == nullptr; }
+
+        // * The queue must not be empty.
+        [[nodiscard]] Job &front() const noexcept { return *_head; }
+
+        // First job, or nullptr; follow Job::next for the others.
+        [[nodiscard]] Job *head() const noexcept { return _head; }
+
+        void push_back(Job *job) noexcept {
+            job->next = nullptr;
+            if (_tail != nullptr) {
+                _tail->next = job;
+            } else {
+                _head = job;
+            }
+            _tail = job;
+        }
+
+        // * The queue must not be empty.
+        Job *pop_front() noexcept {
+            Job *job = _head;
+            _head = job->next;
+            if (_head == nullptr) _tail = nullptr;
+            return job;
+        }
+
+    private:
+        Job *_head{nullptr};
+        Job *_tail{nullptr};
+    };
+}
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef RTSS_LOGGING_EVENT_LOG_H
+#define RTSS_LOGGING_EVENT_LOG_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "rtss/containers/spsc_ring.h"
+
+// Most detailed level compiled in, 0 (OFF) to 3 (DEBUG); see logging::LogLevel.
+// Calls above it compile to nothing.
+#ifndef RTSS_LOG_LEVEL
+#define RTSS_LOG_LEVEL 3
+#endif
+
+namespace rtss::logging {
+    enum class LogLevel : uint8_t {
+        OFF = 0,
+        EVENTS = 1, // cycle/hyperperiod/frame markers, deadline misses
+        JOBS = 2, // every dispatch, idle interval and preemption
+        DEBUG = 3 // remaining execution times
+    };
+
+    constexpr LogLevel COMPILED_LOG_LEVEL = static_cast<LogLevel>(RTSS_LOG_LEVEL);
+
+    [[nodiscard]] constexpr bool compiled_in(LogLevel level) noexcept { return level <= COMPILED_LOG_LEVEL; }
+
+    enum class EventKind : uint8_t {
+        CYCLE_START, // id = cycle number
+        HYPERPERIOD_START, // id = hyperperiod number
+        HYPERPERIOD_END,
+        FRAME_START,
+        PRIORITIES_ASSIGNED,
+        DISPATCH, // value = execution time
+        REMAINING, // value = remaining execution time
+        IDLE, // value = time the processor idles until
+        PREEMPT, // other_id = preempting task
+        DEADLINE_MISS // value = missed absolute deadline
+    };
+
+    // Fixed-size event record. Times are in ns; `time` is simulation time.
+    struct LogRecord {
+        static constexpr int64_t NO_TIME = INT64_MIN;
+
+        int64_t time_ns{NO_TIME};
+        int64_t value_ns{0};
+        int32_t id{0};
+        int32_t other_id{0};
+        EventKind kind{EventKind::DISPATCH};
+        // BinarySink writes whole records, so the padding is a zeroed field rather than
+        // whatever the compiler leaves there.
+        uint8_t _pad[7]{};
+    };
+
+    static_assert(sizeof(LogRecord) == 32 && std::is_trivially_copyable_v<LogRecord>);
+    static_assert(std::has_unique_object_representations_v<LogRecord>, "LogRecord must have no implicit padding");
+
+    // Receives the records on the logger's drain thread, never concurrently.
+    class LogSink {
+    public:
+        virtual ~LogSink() = default;
+
+        virtual void write(const LogRecord *records, size_t n) = 0;
+
+        virtual void flush() {
+        }
+    };
+
+    // One line of text per record, e.g. "[12ms] Running T3 for 2ms".
+    class TextSink : public LogSink {
+    public:
+        // * `os` is not owned and has to outlive the sink.
+        explicit TextSink(std::ostream &os) : _os(&os) {
+        }
+
+        explicit TextSink(const std::filesystem::path &path);
+
+        void write(const LogRecord *records, size_t n) override;
+
+        void flush() override { _os->flush(); }
+
+    private:
+        std::ofstream _file;
+        std::ostream *_os;
+    };
+
+    // The records as they are in memory, back to back.
+    class BinarySink : public LogSink {
+    public:
+        explicit BinarySink(const std::filesystem::path &path);
+
+        void write(const LogRecord *records, size_t n) override;
+
+        void flush() override { _file.flush(); }
+
+    private:
+        std::ofstream _file;
+    };
+
+    // Asynchronous event logger.
+    // Every thread that logs gets its own lock-free ring buffer, so log() costs a few
+    // nanoseconds and never makes a system call; a background thread drains the rings
+    // into the sinks. Records of one thread keep their order.
+    class EventLogger {
+    public:
+        // * With `drop_when_full`, records that find their ring full are counted and dropped
+        // * instead of waiting for the drain thread (for runs against the real clock).
+        explicit EventLogger(size_t ring_capacity = 1 << 13, bool drop_when_full = false);
+
+        // Drains everything logged so far before stopping the drain thread.
+        ~EventLogger();
+
+        EventLogger(const EventLogger &) = delete;
+
+        EventLogger &operator=(const EventLogger &) = delete;
+
+        // Logger the schedulers use unless told otherwise; writes text to std::cout.
+        static EventLogger &global();
+
+        void add_sink(std::unique_ptr<LogSink> sink);
+
+        // Drops all sinks, e.g. to replace the default one of global().
+        void clear_sinks();
+
+        void set_level(LogLevel level) noexcept { _level.store(level, std::memory_order_relaxed); }
+
+        [[nodiscard]] LogLevel level() const noexcept { return _level.load(std::memory_order_relaxed); }
+
+        [[nodiscard]] bool enabled(LogLevel level) const noexcept {
+            return compiled_in(level) && level <= this->level();
+        }
+
+        void log(const LogRecord &record) {
+            ProducerCache &cache = _producer_cache;
+            SpscRing *ring = cache.logger_id == _id ? cache.ring : register_thread();
+            if (!ring->try_push(record)) push_slow(*ring, record);
+        }
+
+        // Blocks until every record logged before the call has been written and the sinks flushed.
+        void flush();
+
+        [[nodiscard]] size_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+    private:
+        using SpscRing = containers::SpscRing<LogRecord>;
+
+        // Ring of the calling thread for the logger it was last used with.
+        struct ProducerCache {
+            uint64_t logger_id{0};
+            SpscRing *ring{nullptr};
+        };
+
+        static thread_local ProducerCache _producer_cache;
+        static std::atomic<uint64_t> _next_id;
+
+        const uint64_t _id;
+        const size_t _ring_capacity;
+        const bool _drop_when_full;
+        std::atomic<LogLevel> _level{LogLevel::DEBUG};
+        std::atomic<size_t> _dropped{0};
+
+        // Guards the ring and sink lists and the flush/stop state.
+        std::mutex _m;
+        std::condition_variable _drain_cv, _flushed_cv;
+        std::vector<std::pair<std::thread::id, std::unique_ptr<SpscRing> > > _rings;
+        std::vector<std::unique_ptr<LogSink> > _sinks;
+        uint64_t _flush_requested{0}, _flush_done{0};
+        bool _stop{false};
+        std::thread _drain_thread;
+
+        SpscRing *register_thread();
+
+        void push_slow(SpscRing &ring, const LogRecord &record);
+
+        void drain_loop();
+    };
+}
+
+#endif
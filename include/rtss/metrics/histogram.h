@@ -0,0 +1,96 @@
+#ifndef RTSS_METRICS_HISTOGRAM_H
+#define RTSS_METRICS_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtss::metrics {
+    // Histogram of integer values with the bucket layout of HdrHistogram: values below
+    // 2^k are counted exactly, larger ones in buckets whose width is a fixed fraction of
+    // their value, so every recorded value is known to `significant_digits` decimal digits
+    // over the whole int64 range.
+    // Recording is a few integer operations. Only the buckets between the smallest and the
+    // largest value seen are allocated, so a histogram of values that stay within a factor
+    // of ten of each other takes about a kilobyte, and one of a constant value a single bucket.
+    // Negative values are counted by magnitude in a second array.
+    class HdrHistogram {
+    public:
+        // * `significant_digits` is 1 to 5.
+        explicit HdrHistogram(int significant_digits = 2);
+
+        void record(int64_t value) {
+            _count++;
+            _sum += static_cast<double>(value);
+            if (value < _min) _min = value;
+            if (value > _max) _max = value;
+            if (value >= 0) {
+                _counts.bump(index_of(static_cast<uint64_t>(value)));
+            } else {
+                _neg_counts.bump(index_of(0 - static_cast<uint64_t>(value)));
+            }
+        }
+
+        // Adds the counts of `other`, which has to use the same number of significant digits.
+        void merge(const HdrHistogram &other);
+
+        void reset() noexcept;
+
+        [[nodiscard]] int significant_digits() const noexcept { return _digits; }
+
+        [[nodiscard]] uint64_t count() const noexcept { return _count; }
+
+        // Exact; 0 if nothing was recorded.
+        [[nodiscard]] int64_t min() const noexcept { return _count > 0 ? _min : 0; }
+
+        [[nodiscard]] int64_t max() const noexcept { return _count > 0 ? _max : 0; }
+
+        [[nodiscard]] double mean() const noexcept { return _count > 0 ? _sum / static_cast<double>(_count) : 0.0; }
+
+        // Smallest value v such that `percentile` percent of the recorded values are <= v,
+        // up to the histogram's precision; 0 if nothing was recorded.
+        // * `percentile` is in [0, 100].
+        [[nodiscard]] int64_t value_at_percentile(double percentile) const;
+
+    private:
+        // Counts of the buckets from `base` on.
+        struct Buckets {
+            size_t base{0};
+            std::vector<uint64_t> counts;
+
+            [[nodiscard]] size_t end() const noexcept { return base + counts.size(); }
+
+            void bump(size_t idx) {
+                if (idx - base >= counts.size()) grow(idx);
+                counts[idx - base]++;
+            }
+
+            // Makes room for bucket `idx`, growing geometrically in its direction.
+            void grow(size_t idx);
+
+            void add(const Buckets &other);
+        };
+
+        int _digits;
+        // log2 of the number of exact values; buckets above hold 2^(_sub_bits-1) slots each.
+        unsigned _sub_bits;
+        Buckets _counts, _neg_counts;
+        uint64_t _count{0};
+        double _sum{0.0};
+        int64_t _min{INT64_MAX}, _max{INT64_MIN};
+
+        [[nodiscard]] size_t index_of(uint64_t magnitude) const noexcept {
+            const uint64_t sub_count = uint64_t{1} << _sub_bits;
+            if (magnitude < sub_count) return magnitude;
+            const unsigned shift = 64 - __builtin_clzll(magnitude) - _sub_bits;
+            return sub_count + (shift - 1) * (sub_count >> 1) + ((magnitude >> shift) - (sub_count >> 1));
+        }
+
+        // Largest and smallest magnitude that fall into bucket `idx`.
+        [[nodiscard]] uint64_t highest_in(size_t idx) const noexcept;
+
+        [[nodiscard]] uint64_t lowest_in(size_t idx) const noexcept;
+    };
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef RTSS_METRICS_RECORDER_H
+#define RTSS_METRICS_RECORDER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rtss/metrics/histogram.h"
+#include "rtss/schedulers/observer.h"
+#include "rtss/task.h"
+
+namespace rtss::metrics {
+    // What happened to one task's jobs. Histograms hold nanoseconds.
+    struct TaskMetrics {
+        explicit TaskMetrics(int significant_digits = 2)
+            : response_tm(significant_digits), lateness(significant_digits), start_latency(significant_digits),
+              start_jitter(significant_digits), finish_jitter(significant_digits) {
+        }
+
+        size_t released_jobs{0};
+        size_t completed_jobs{0};
+        // Includes jobs still unfinished when their deadline passed at the end of the run.
+        size_t deadline_misses{0};
+        size_t preemptions{0};
+        // Resumptions on a different core than the job was preempted on.
+        size_t migrations{0};
+        time::TimeDuration exec_tm{time::ZERO_DURATION};
+
+        // finish - release of each completed job.
+        HdrHistogram response_tm;
+        // finish - absolute deadline; negative if the job finished early. Jobs without a deadline are left out.
+        HdrHistogram lateness;
+        // start - release. The absolute start jitter is its max() - min(), the absolute
+        // finish jitter that of response_tm.
+        HdrHistogram start_latency;
+        // |start latency of a job - that of the task's previous job|.
+        HdrHistogram start_jitter;
+        // |response time of a job - that of the task's previous job|.
+        HdrHistogram finish_jitter;
+    };
+
+    // Observer that turns a scheduler's callbacks into per-task metrics, e.g.
+    //     metrics::MetricsRecorder recorder(tasks);
+    //     scheduler.add_observer(&recorder);
+    //     scheduler.run_scheduler(n);
+    //     recorder.task(0).response_tm.value_at_percentile(99);
+    // Recording is O(1) per event with no allocation once the histograms have grown to the
+    // range of the values, so it can stay on for every run. Several runs accumulate until reset().
+    // The table-driven and priority-based schedulers only report dispatches, so with them
+    // only execution times and utilisation are filled in.
+    class MetricsRecorder : public schedulers::SchedulerObserver {
+    public:
+        // * `tasks` is the scheduler's task list; only its size and the task ids are used.
+        explicit MetricsRecorder(const std::vector<Task *> &tasks, int significant_digits = 2);
+
+        void on_release(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) override;
+
+        void on_dispatch(time::TimeDuration t, size_t task_idx, size_t core) override;
+
+        void on_preempt(time::TimeDuration t, size_t task_idx) override;
+
+        void on_migrate(time::TimeDuration t, size_t task_idx, size_t from_core, size_t to_core) override;
+
+        void on_complete(time::TimeDuration t, size_t task_idx, time::TimeDuration release,
+                         time::TimeDuration abs_dl) override;
+
+        void on_deadline_miss(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) override;
+
+        void on_finish(time::TimeDuration t) override;
+
+        void reset();
+
+        [[nodiscard]] size_t size() const noexcept { return _tasks.size(); }
+
+        // Indexed as the task list.
+        [[nodiscard]] const TaskMetrics &task(size_t task_idx) const { return _tasks.at(task_idx); }
+
+        // All tasks merged into one.
+        [[nodiscard]] TaskMetrics total() const;
+
+        // Time the cores spent running jobs, summed over the cores, and the length of the recorded runs.
+        [[nodiscard]] time::TimeDuration busy_time() const noexcept { return _busy_tm; }
+
+        [[nodiscard]] time::TimeDuration elapsed() const noexcept { return _elapsed; }
+
+        // Cores dispatched to so far.
+        [[nodiscard]] size_t ncores() const noexcept { return _running.size(); }
+
+        // busy_time() / (elapsed() * ncores()), 0 before the first run.
+        [[nodiscard]] double utilisation() const noexcept;
+
+        // Table of the per-task metrics, one row per task, times in ms.
+        [[nodiscard]] std::string to_string() const;
+
+    private:
+        // Current job of a task.
+        struct JobTrack {
+            time::TimeDuration start{time::ZERO_DURATION};
+            bool started{false};
+            // Start latency and response time of the previous completed job, for the jitters.
+            time::TimeDuration prev_latency{time::ZERO_DURATION}, prev_response{time::ZERO_DURATION};
+            bool has_prev{false};
+        };
+
+        int _digits;
+        std::vector<int32_t> _task_ids;
+        std::vector<TaskMetrics> _tasks;
+        std::vector<JobTrack> _jobs;
+        time::TimeDuration _busy_tm{time::ZERO_DURATION}, _elapsed{time::ZERO_DURATION};
+
+        // State of the run in progress.
+        bool _in_run{false};
+        // Task on each core and since when.
+        std::vector<size_t> _running;
+        std::vector<time::TimeDuration> _running_since;
+
+        void begin_run();
+
+        // Charges the time since the last dispatch on `core` to the task running there.
+        void close_interval(size_t core, time::TimeDuration t);
+    };
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef RTSS_PARALLEL_BATCH_H
+#define RTSS_PARALLEL_BATCH_H
+
+#include <string>
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/analysis/partition.h"
+#include "rtss/parallel/thread_pool.h"
+#include "rtss/schedulers/preemptive.h"
+
+namespace rtss::parallel {
+    // Outcome of simulating one task set under one policy.
+    struct BatchResult {
+        size_t set_idx{0};
+        schedulers::PreemptivePolicy policy{schedulers::PreemptivePolicy::EDF};
+        // No deadline was missed in the simulated hyperperiods.
+        bool schedulable{false};
+        schedulers::SimulationStats stats;
+        // Set if the simulation could not be run (e.g. the hyperperiod overflows).
+        std::string error;
+    };
+
+    struct PolicySummary {
+        schedulers::PreemptivePolicy policy{schedulers::PreemptivePolicy::EDF};
+        size_t nsets{0};
+        size_t nschedulable{0};
+        size_t nerrors{0};
+        size_t deadline_misses{0};
+        size_t preemptions{0};
+    };
+
+    class BatchSummary {
+    public:
+        BatchSummary(std::vector<BatchResult> &&results, const std::vector<schedulers::PreemptivePolicy> &policies);
+
+        // One result per task set and policy, ordered by task set, then as the policies were given.
+        [[nodiscard]] const std::vector<BatchResult> &results() const noexcept { return _results; }
+
+        [[nodiscard]] const BatchResult &result(size_t set_idx, size_t policy_idx) const {
+            return _results.at(set_idx * _per_policy.size() + policy_idx);
+        }
+
+        [[nodiscard]] const std::vector<PolicySummary> &per_policy() const noexcept { return _per_policy; }
+
+        // Summary table, one row per policy.
+        [[nodiscard]] std::string to_string() const;
+
+    private:
+        std::vector<BatchResult> _results;
+        std::vector<PolicySummary> _per_policy;
+    };
+
+    // Outcome of partitioning one task set with one heuristic.
+    struct PartitionResult {
+        size_t set_idx{0};
+        analysis::FitHeuristic heuristic{analysis::FitHeuristic::FIRST_FIT};
+        analysis::Partition partition;
+        // Set if the task set could not be partitioned (e.g. it has aperiodic tasks).
+        std::string error;
+    };
+
+    struct HeuristicSummary {
+        analysis::FitHeuristic heuristic{analysis::FitHeuristic::FIRST_FIT};
+        size_t nsets{0};
+        // Task sets with every task placed.
+        size_t nfeasible{0};
+        size_t nerrors{0};
+        size_t unassigned{0};
+        size_t exact_tests{0};
+    };
+
+    class PartitionSummary {
+    public:
+        PartitionSummary(std::vector<PartitionResult> &&results, const std::vector<analysis::FitHeuristic> &heuristics,
+                         analysis::AcceptanceTest test);
+
+        // One result per task set and heuristic, ordered by task set, then as the heuristics were given.
+        [[nodiscard]] const std::vector<PartitionResult> &results() const noexcept { return _results; }
+
+        [[nodiscard]] const PartitionResult &result(size_t set_idx, size_t heuristic_idx) const {
+            return _results.at(set_idx * _per_heuristic.size() + heuristic_idx);
+        }
+
+        [[nodiscard]] const std::vector<HeuristicSummary> &per_heuristic() const noexcept { return _per_heuristic; }
+
+        [[nodiscard]] analysis::AcceptanceTest test() const noexcept { return _test; }
+
+        // Summary table, one row per heuristic.
+        [[nodiscard]] std::string to_string() const;
+
+    private:
+        std::vector<PartitionResult> _results;
+        std::vector<HeuristicSummary> _per_heuristic;
+        analysis::AcceptanceTest _test;
+    };
+
+    // Simulates many task sets under several preemptive policies, or partitions them, in parallel.
+    // Every (task set, policy) pair is an independent job: it builds its own scheduler,
+    // whose job state is separate from the Task objects, and runs it on a time::VirtualClock.
+    // The tasks are only read, so one task set can be simulated under all policies at once.
+    class BatchRunner {
+    public:
+        // * nthreads = 0 uses all hardware threads.
+        explicit BatchRunner(size_t nthreads = 0) : _pool(nthreads) {
+        }
+
+        BatchSummary run(std::vector<std::vector<Task *> > &task_sets,
+                         const std::vector<schedulers::PreemptivePolicy> &policies, size_t nhyperperiods = 1);
+
+        // Partitions every task set onto `ncores` cores with each heuristic, one job per
+        // (task set, heuristic) pair, to compare how many sets each heuristic fits.
+        PartitionSummary run_partitioning(const std::vector<std::vector<Task *> > &task_sets, size_t ncores,
+                                          const std::vector<analysis::FitHeuristic> &heuristics,
+                                          analysis::AcceptanceTest test);
+
+        [[nodiscard]] size_t nthreads() const noexcept { return _pool.size(); }
+
+    private:
+        ThreadPool _pool;
+    };
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef RTSS_PARALLEL_THREAD_POOL_H
+#define RTSS_PARALLEL_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rtss::parallel {
+    // Fixed-size thread pool with one job queue per worker.
+    // A worker takes jobs from the back of its own queue and, once that is empty,
+    // steals from the front of the other workers' queues, so uneven jobs
+    // (e.g. simulations of very different hyperperiods) still keep every core busy.
+    class ThreadPool {
+    public:
+        // * nthreads = 0 uses std::thread::hardware_concurrency().
+        explicit ThreadPool(size_t nthreads = 0);
+
+        // Finishes the queued jobs before joining the workers.
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        // Jobs submitted from a worker go to that worker's own queue,
+        // the others are spread round-robin.
+        void submit(std::function<void()> job);
+
+        // Block until every submitted job has finished.
+        // Rethrows the first exception a job threw since the last wait_idle().
+        void wait_idle();
+
+        [[nodiscard]] size_t size() const noexcept { return _threads.size(); }
+
+    private:
+        struct WorkQueue {
+            std::mutex m;
+            std::deque<std::function<void()> > jobs;
+        };
+
+        std::vector<std::unique_ptr<WorkQueue> > _queues;
+        std::vector<std::thread> _threads;
+
+        std::mutex _m;
+        std::condition_variable _work_cv, _idle_cv;
+        // Jobs sitting in the queues and jobs not finished yet.
+        std::atomic<long> _queued{0};
+        std::atomic<size_t> _unfinished{0};
+        std::atomic<size_t> _next_queue{0};
+        bool _stop{false};
+        std::exception_ptr _error;
+
+        void worker_loop(size_t self);
+
+        bool try_pop(size_t self, std::function<void()> &job);
+    };
+}
+
+#endif
@@ -1,9 +1,14 @@
 #ifndef RTSS_SCHEDULERS_RTSCHEDULER_H
 #define RTSS_SCHEDULERS_RTSCHEDULER_H
 
+#include <memory>
 #include <vector>
 
 #include "rtss/task.h"
+#include "rtss/taskset.h"
+#include "rtss/clock.h"
+#include "rtss/logging/event_log.h"
+#include "rtss/schedulers/observer.h"
 
 namespace rtss {
     enum class StaticSchedulingMode {
@@ -20,7 +25,7 @@ namespace rtss::schedulers {
     class RTScheduler {
     public:
         explicit RTScheduler(const std::vector<Task *> &tasks)
-            : tasks(tasks) {
+            : tasks(tasks), task_set(tasks) {
         }
 
         RTScheduler() = delete;
@@ -29,6 +34,34 @@ namespace rtss::schedulers {
 
         virtual void run_scheduler(size_t ncycles) = 0;
 
+        // * Replace the clock the scheduler runs against,
+        // * e.g. with time::VirtualClock to simulate without sleeping.
+        void set_clock(std::unique_ptr<time::SimClock> clock) {
+            if (clock == nullptr) {
+                throw std::runtime_error("[RTScheduler::set_clock] Clock cannot be null");
+            }
+            sim_clock = std::move(clock);
+        }
+
+        [[nodiscard]] time::SimClock &get_clock() const noexcept { return *sim_clock; }
+
+        [[nodiscard]] const TaskSet &get_task_set() const noexcept { return task_set; }
+
+        void set_verbose(bool v) noexcept { verbose = v; }
+
+        // * The logger is not owned and has to outlive the runs it records.
+        void set_logger(logging::EventLogger &logger) noexcept { this->logger = &logger; }
+
+        [[nodiscard]] logging::EventLogger &get_logger() const noexcept { return *logger; }
+
+        // * The observer is not owned and has to outlive the runs it watches.
+        void add_observer(SchedulerObserver *observer) {
+            if (observer == nullptr) {
+                throw std::runtime_error("[RTScheduler::add_observer] Observer cannot be null");
+            }
+            observers.push_back(observer);
+        }
+
         RTScheduler(const RTScheduler &) = delete;
 
         RTScheduler &operator=(const RTScheduler &) = delete;
@@ -39,6 +72,42 @@ namespace rtss::schedulers {
 
     protected:
         const std::vector<Task *> tasks;
+        // Parameters of `tasks` for the dispatch loops, indexed the same way.
+        TaskSet task_set;
+        std::unique_ptr<time::SimClock> sim_clock{std::make_unique<time::RealClock>()};
+        // Log scheduling events (to std::cout through the global logger by default).
+        bool verbose{true};
+        logging::EventLogger *logger{&logging::EventLogger::global()};
+        std::vector<SchedulerObserver *> observers;
+
+        // Records an event at time `t`. Levels above RTSS_LOG_LEVEL compile to nothing,
+        // so the hot paths pay for logging only when it is compiled in and switched on.
+        template<logging::LogLevel L>
+        void log_event(time::TimeDuration t, logging::EventKind kind, int32_t id,
+                       time::TimeDuration value = time::ZERO_DURATION, int32_t other_id = 0) const {
+            if constexpr (logging::compiled_in(L)) {
+                if (verbose && logger->enabled(L)) {
+                    logger->log({time::to_ns(t), time::to_ns(value), id, other_id, kind});
+                }
+            }
+        }
+
+        // Same, stamped with the scheduler clock (read only if the event is logged).
+        template<logging::LogLevel L>
+        void log_event(logging::EventKind kind, int32_t id = 0, time::TimeDuration value = time::ZERO_DURATION,
+                       int32_t other_id = 0) const {
+            if constexpr (logging::compiled_in(L)) {
+                if (verbose && logger->enabled(L)) {
+                    logger->log({time::to_ns(sim_clock->now()), time::to_ns(value), id, other_id, kind});
+                }
+            }
+        }
+
+        // Waits for the logged events to reach the sinks, so that a run's output does not
+        // interleave with whatever the caller prints next.
+        void flush_log() const {
+            if (verbose) logger->flush();
+        }
     };
 }
 
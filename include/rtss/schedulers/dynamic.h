@@ -1,11 +1,14 @@
 #ifndef RTSS_SCHEDULERS_PRIORITY_BASED_H
 #define RTSS_SCHEDULERS_PRIORITY_BASED_H
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "rtss/schedulers/RTScheduler.h"
 
 namespace rtss::schedulers {
+    // Non-preemptive priority-driven scheduling; the priority order comes from assign_priorities().
     class PriorityBasedScheduler : public RTScheduler {
     public:
         explicit PriorityBasedScheduler(std::vector<Task *> &tasks, PriorityMode priority_mode)
@@ -18,62 +21,110 @@ namespace rtss::schedulers {
 
         void run_scheduler(size_t ncycles) override;
 
-    protected:
-        void assign_priorities(std::vector<size_t> &idx);
+        // Task indices from highest priority to lowest, as of the last priority assignment.
+        [[nodiscard]] const std::vector<size_t> &get_priority_order() const noexcept { return pri_idx; }
 
-        virtual bool compare(PeriodicTask *P1, PeriodicTask *P2) = 0;
+    protected:
+        // Sort `idx` from highest priority to lowest as of decision_tm.
+        virtual void assign_priorities(std::vector<size_t> &idx) = 0;
 
         // Fields.
         // List of indices from highest priority to lowest,
         // where each index corresponds to the task list.
         std::vector<size_t> pri_idx{0};
+        // Clock reading the current priorities were assigned at.
+        time::TimeDuration decision_tm{time::ZERO_DURATION};
 
     private:
         PriorityMode _priority_mode;
     };
 
-    class RateMonotonicScheduler : public PriorityBasedScheduler {
-    public:
-        explicit RateMonotonicScheduler(std::vector<Task *> &tasks)
-            : PriorityBasedScheduler(tasks, PriorityMode::FIXED) {
-            PriorityBasedScheduler::assign_priorities(this->pri_idx);
-        }
+    // Priority policies for PriorityScheduler.
+    // key() is the priority key of periodic task i of `ts` at time `now`; the lower the key,
+    // the higher the priority.
+    struct RMPolicy {
+        static constexpr PriorityMode MODE = PriorityMode::FIXED;
 
-    private:
-        bool compare(PeriodicTask *P1, PeriodicTask *P2) override;
+        static time::TimeDuration key(const TaskSet &ts, size_t i, time::TimeDuration) noexcept {
+            return ts.period(i);
+        }
     };
 
-    class DeadlineMonotonicScheduler : public PriorityBasedScheduler {
-    public:
-        explicit DeadlineMonotonicScheduler(std::vector<Task *> &tasks)
-            : PriorityBasedScheduler(tasks, PriorityMode::FIXED) {
-            PriorityBasedScheduler::assign_priorities(this->pri_idx);
-        }
+    struct DMPolicy {
+        static constexpr PriorityMode MODE = PriorityMode::FIXED;
 
-    private:
-        bool compare(PeriodicTask *P1, PeriodicTask *P2) override;
+        static time::TimeDuration key(const TaskSet &ts, size_t i, time::TimeDuration) noexcept {
+            return ts.rel_dl(i);
+        }
     };
 
-    class EarliestDeadlineFirstScheduler : public PriorityBasedScheduler {
-    public:
-        explicit EarliestDeadlineFirstScheduler(std::vector<Task *> &tasks)
-            : PriorityBasedScheduler(tasks, PriorityMode::DYNAMIC) {
+    struct EDFPolicy {
+        static constexpr PriorityMode MODE = PriorityMode::DYNAMIC;
+
+        static time::TimeDuration key(const TaskSet &ts, size_t i, time::TimeDuration now) noexcept {
+            return ts.abs_dl(i, now);
         }
+    };
 
-    private:
-        bool compare(PeriodicTask *P1, PeriodicTask *P2) override;
+    struct LLFPolicy {
+        static constexpr PriorityMode MODE = PriorityMode::DYNAMIC;
+
+        static time::TimeDuration key(const TaskSet &ts, size_t i, time::TimeDuration now) noexcept {
+            return ts.laxity(i, now);
+        }
     };
 
-    class LeastLaxityFirstScheduler : public PriorityBasedScheduler {
+    // Priority-driven scheduler with the policy fixed at compile time.
+    // The keys are computed once per assignment and the sort compares them inline,
+    // instead of going through a virtual call per comparison.
+    // Periodic tasks come before the others, which are ordered by WCET;
+    // ties go to the lower task index.
+    template<typename Policy>
+    class PriorityScheduler : public PriorityBasedScheduler {
     public:
-        explicit LeastLaxityFirstScheduler(std::vector<Task *> &tasks)
-            : PriorityBasedScheduler(tasks, PriorityMode::DYNAMIC) {
+        explicit PriorityScheduler(std::vector<Task *> &tasks)
+            : PriorityBasedScheduler(tasks, Policy::MODE) {
+            if (Policy::MODE == PriorityMode::FIXED) {
+                PriorityScheduler::assign_priorities(this->pri_idx);
+            }
+        }
+
+    protected:
+        void assign_priorities(std::vector<size_t> &idx) override {
+            const size_t n = this->task_set.size();
+            if (n == 0) return;
+
+            // Sort (key, index) records rather than indices, so the sort walks contiguous memory
+            // instead of looking the keys up at random. Periodic tasks are sorted in front,
+            // the rest behind them.
+            this->decision_tm = this->sim_clock->now();
+            _order.resize(n);
+            size_t nperiodic = 0, back = n;
+            for (size_t i = 0; i < n; i++) {
+                if (this->task_set.is_periodic(i)) {
+                    _order[nperiodic++] = {Policy::key(this->task_set, i, this->decision_tm).count(), i};
+                } else {
+                    _order[--back] = {this->task_set.wcet(i).count(), i};
+                }
+            }
+            std::sort(_order.begin(), _order.begin() + nperiodic);
+            std::sort(_order.begin() + nperiodic, _order.end());
+            idx.resize(n);
+            for (size_t k = 0; k < n; k++) {
+                idx[k] = _order[k].second;
+            }
         }
 
     private:
-        bool compare(PeriodicTask *P1, PeriodicTask *P2) override;
+        // Priority key (WCET for non-periodic tasks) and task index.
+        std::vector<std::pair<int64_t, size_t> > _order;
     };
 
+    using RateMonotonicScheduler = PriorityScheduler<RMPolicy>;
+    using DeadlineMonotonicScheduler = PriorityScheduler<DMPolicy>;
+    using EarliestDeadlineFirstScheduler = PriorityScheduler<EDFPolicy>;
+    using LeastLaxityFirstScheduler = PriorityScheduler<LLFPolicy>;
+
     using RM = RateMonotonicScheduler;
     using DM = DeadlineMonotonicScheduler;
     using EDF = EarliestDeadlineFirstScheduler;
@@ -0,0 +1,83 @@
+#ifndef RTSS_SCHEDULERS_GLOBAL_H
+#define RTSS_SCHEDULERS_GLOBAL_H
+
+#include <memory>
+#include <vector>
+
+#include "rtss/schedulers/preemptive.h"
+
+namespace rtss::schedulers {
+    enum class GlobalPolicy { EDF, RM, DM, EDZL };
+
+    [[nodiscard]] const char *to_string(GlobalPolicy policy) noexcept;
+
+    // Event-driven global scheduling on `ncores` identical cores.
+    // All ready jobs share one queue and at every event the `ncores` highest-priority ones
+    // run, so a job can be preempted on one core and resume on another (a migration).
+    // Jobs keep their core while they stay among the highest; a job that has to move goes back
+    // to the core it last ran on if that one is free.
+    // Priorities follow the uniprocessor policies: EDF orders on absolute deadline, RM and DM
+    // on the priority order of RateMonotonicScheduler and DeadlineMonotonicScheduler, ties go
+    // to the lower task index and jobs without a deadline run in the background.
+    // Each decision costs O(log n + ncores).
+    class GlobalScheduler : public PreemptiveScheduler {
+    public:
+        GlobalScheduler(std::vector<Task *> &tasks, size_t ncores, GlobalPolicy policy);
+
+        // * Simulates `nhyperperiods` hyperperiods of continuous time.
+        void run_scheduler(size_t nhyperperiods) override;
+
+        [[nodiscard]] size_t get_ncores() const noexcept { return ncores; }
+
+        [[nodiscard]] GlobalPolicy get_policy() const noexcept { return policy; }
+
+    protected:
+        size_t ncores;
+        GlobalPolicy policy;
+        // Priority level of each task under RM and DM, indexed as the task list.
+        std::vector<size_t> pri_level;
+    };
+
+    // Global EDF.
+    class GlobalEDFScheduler : public GlobalScheduler {
+    public:
+        GlobalEDFScheduler(std::vector<Task *> &tasks, size_t ncores)
+            : GlobalScheduler(tasks, ncores, GlobalPolicy::EDF) {
+        }
+    };
+
+    // Global fixed priorities as assigned by RateMonotonicScheduler.
+    class GlobalRMScheduler : public GlobalScheduler {
+    public:
+        GlobalRMScheduler(std::vector<Task *> &tasks, size_t ncores)
+            : GlobalScheduler(tasks, ncores, GlobalPolicy::RM) {
+        }
+    };
+
+    // Global fixed priorities as assigned by DeadlineMonotonicScheduler.
+    class GlobalDMScheduler : public GlobalScheduler {
+    public:
+        GlobalDMScheduler(std::vector<Task *> &tasks, size_t ncores)
+            : GlobalScheduler(tasks, ncores, GlobalPolicy::DM) {
+        }
+    };
+
+    // EDZL: global EDF, except that a waiting job whose laxity reaches zero gets the highest
+    // priority, so it runs from then on and meets its deadline if a core is left for it.
+    class GlobalEDZLScheduler : public GlobalScheduler {
+    public:
+        GlobalEDZLScheduler(std::vector<Task *> &tasks, size_t ncores)
+            : GlobalScheduler(tasks, ncores, GlobalPolicy::EDZL) {
+        }
+    };
+
+    using GEDF = GlobalEDFScheduler;
+    using GRM = GlobalRMScheduler;
+    using GDM = GlobalDMScheduler;
+    using EDZL = GlobalEDZLScheduler;
+
+    std::unique_ptr<GlobalScheduler> make_global_scheduler(std::vector<Task *> &tasks, size_t ncores,
+                                                           GlobalPolicy policy);
+}
+
+#endif
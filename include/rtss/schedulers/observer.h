@@ -0,0 +1,51 @@
+#ifndef RTSS_SCHEDULERS_OBSERVER_H
+#define RTSS_SCHEDULERS_OBSERVER_H
+
+#include <cstdint>
+
+#include "rtss/time.h"
+
+namespace rtss::schedulers {
+    // Task index passed to on_dispatch() when a core goes idle.
+    constexpr size_t IDLE_TASK = SIZE_MAX;
+
+    // Callbacks from a running scheduler, registered with RTScheduler::add_observer().
+    // Times are scheduler clock times (time::SimClock::now()), task_idx indexes the task list
+    // and cores are numbered from 0; the uniprocessor schedulers only use core 0.
+    // The preemptive and global schedulers report every callback; the table-driven and
+    // priority-based ones only know about dispatches, so they report on_dispatch() and on_finish().
+    class SchedulerObserver {
+    public:
+        virtual ~SchedulerObserver() = default;
+
+        virtual void on_release(time::TimeDuration /*t*/, size_t /*task_idx*/, time::TimeDuration /*abs_dl*/) {
+        }
+
+        // From t on `core` runs task_idx (IDLE_TASK if nothing).
+        // Also called when a task goes straight on to its next job, so the first dispatch
+        // of a task after a completion always marks the start of its next job.
+        virtual void on_dispatch(time::TimeDuration /*t*/, size_t /*task_idx*/, size_t /*core*/) {
+        }
+
+        virtual void on_preempt(time::TimeDuration /*t*/, size_t /*task_idx*/) {
+        }
+
+        // The job of task_idx resumes at t on a different core than it was preempted on.
+        virtual void on_migrate(time::TimeDuration /*t*/, size_t /*task_idx*/, size_t /*from_core*/,
+                                size_t /*to_core*/) {
+        }
+
+        virtual void on_complete(time::TimeDuration /*t*/, size_t /*task_idx*/, time::TimeDuration /*release*/,
+                                 time::TimeDuration /*abs_dl*/) {
+        }
+
+        virtual void on_deadline_miss(time::TimeDuration /*t*/, size_t /*task_idx*/, time::TimeDuration /*abs_dl*/) {
+        }
+
+        // The run is over at t.
+        virtual void on_finish(time::TimeDuration /*t*/) {
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef RTSS_SCHEDULERS_PARTITIONED_H
+#define RTSS_SCHEDULERS_PARTITIONED_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "rtss/analysis/partition.h"
+#include "rtss/parallel/thread_pool.h"
+#include "rtss/schedulers/preemptive.h"
+
+namespace rtss::schedulers {
+    // Partitioned scheduling: every core runs its own uniprocessor preemptive scheduler over
+    // the tasks analysis::partition_tasks() assigned to it, and tasks never migrate.
+    // The cores run in parallel on a thread pool, each against its own clock of the same kind
+    // as this scheduler's (virtual, or real with the same time::WaitMode). A run covers
+    // `nhyperperiods` hyperperiods of the whole task set, i.e. a whole number of each core's
+    // own hyperperiods.
+    // Observers see every core, with task indices of the whole task list; callbacks of
+    // different cores are serialised but not ordered in time across cores.
+    class PartitionedScheduler : public PreemptiveScheduler {
+    public:
+        // * Throws if the partition does not match the task list or leaves tasks unassigned.
+        // * nthreads = 0 uses one thread per core that has tasks.
+        PartitionedScheduler(std::vector<Task *> &tasks, const analysis::Partition &partition,
+                             PreemptivePolicy policy, size_t nthreads = 0);
+
+        ~PartitionedScheduler() override;
+
+        // * Simulates `nhyperperiods` hyperperiods of the whole task set.
+        void run_scheduler(size_t nhyperperiods) override;
+
+        [[nodiscard]] size_t get_ncores() const noexcept { return _cores.size(); }
+
+        [[nodiscard]] PreemptivePolicy get_policy() const noexcept { return _policy; }
+
+        // Statistics of one core's last run, indexed as the tasks on that core.
+        [[nodiscard]] const SimulationStats &get_core_stats(size_t core) const;
+
+    private:
+        class CoreObserver;
+
+        struct Core {
+            // Tasks on the core and their indices in the task list.
+            std::vector<Task *> tasks;
+            std::vector<size_t> task_idx;
+            std::unique_ptr<PreemptiveScheduler> scheduler;
+            std::unique_ptr<CoreObserver> observer;
+            SimulationStats stats;
+        };
+
+        PreemptivePolicy _policy;
+        std::vector<Core> _cores;
+        parallel::ThreadPool _pool;
+        // Serialises the callbacks of the cores.
+        std::mutex _observer_m;
+    };
+}
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef RTSS_SCHEDULERS_PREEMPTIVE_H
+#define RTSS_SCHEDULERS_PREEMPTIVE_H
+
+#include <memory>
+#include <vector>
+
+#include "rtss/job.h"
+#include "rtss/schedulers/RTScheduler.h"
+
+namespace rtss::schedulers {
+    struct SimulationStats {
+        size_t released_jobs{0};
+        size_t completed_jobs{0};
+        size_t deadline_misses{0};
+        size_t preemptions{0};
+        // Jobs resumed on another core than they were preempted on (global scheduling only).
+        size_t migrations{0};
+        // Worst observed response time of each task, indexed as the task list.
+        std::vector<time::TimeDuration> max_response_tm;
+    };
+
+    // A task's parameters and its released, unfinished jobs, as tracked by PreemptiveScheduler.
+    struct JobState {
+        time::TimeDuration phase{time::ZERO_DURATION}, period{time::ZERO_DURATION};
+        time::TimeDuration wcet{time::ZERO_DURATION}, rel_dl{time::ZERO_DURATION};
+        bool periodic{false};
+        // In release order. The jobs of a task run one after the other, so only the first,
+        // the current job, can run; the others were released before it completed
+        // (rel_dl > period, or an overrun).
+        JobQueue pending;
+        // Sequence number of the task's next job.
+        uint64_t next_seq{0};
+
+        [[nodiscard]] bool active() const noexcept { return !pending.empty(); }
+
+        // * The task must be active.
+        [[nodiscard]] Job &current() const noexcept { return pending.front(); }
+    };
+
+    // Event-driven, preemptive job-level scheduler.
+    // Time moves from event to event (release, completion, end of run) and at every
+    // event the highest-priority ready job runs, preempting the current one if needed.
+    // Ready jobs are kept in a priority queue, so each decision costs O(log n).
+    // Job records come from a JobPool, so once it has grown a run does not allocate per job.
+    class PreemptiveScheduler : public RTScheduler {
+    public:
+        explicit PreemptiveScheduler(std::vector<Task *> &tasks);
+
+        // * Simulates `nhyperperiods` hyperperiods of continuous time.
+        void run_scheduler(size_t nhyperperiods) override = 0;
+
+        [[nodiscard]] const SimulationStats &get_stats() const noexcept { return stats; }
+
+        [[nodiscard]] time::TimeDuration get_hyperperiod() const noexcept { return hyperperiod; }
+
+        // Pool the jobs of the runs come from; it is kept from one run to the next.
+        [[nodiscard]] const JobPool &get_job_pool() const noexcept { return job_pool; }
+
+    protected:
+        // ReadyQueue must provide empty(), top(), insert(i), remove(i) and update(i),
+        // where update(i) is called after job i has run for a while.
+        template<typename ReadyQueue>
+        void simulate(ReadyQueue &ready, size_t nhyperperiods);
+
+        // Queues a new job of task i released at `release` behind the task's pending ones.
+        Job &release_job(size_t i, time::TimeDuration release);
+
+        // Returns the current job of task i to the pool; the next pending one becomes current.
+        void retire_job(size_t i) noexcept;
+
+        // Returns every pending job to the pool and restarts the sequence numbers.
+        void clear_jobs() noexcept;
+
+        // Indexed as the task list.
+        std::vector<JobState> jobs;
+        JobPool job_pool;
+        time::TimeDuration hyperperiod{time::ZERO_DURATION};
+        SimulationStats stats;
+    };
+
+    // Preemptive EDF: the job with the earliest absolute deadline runs.
+    class PreemptiveEDFScheduler : public PreemptiveScheduler {
+    public:
+        explicit PreemptiveEDFScheduler(std::vector<Task *> &tasks)
+            : PreemptiveScheduler(tasks) {
+        }
+
+        void run_scheduler(size_t nhyperperiods) override;
+    };
+
+    // Preemptive LLF: the job with the least laxity runs.
+    // Laxities are compared at scheduling events only (releases and completions),
+    // which avoids the thrashing of continuous LLF between jobs of equal laxity.
+    class PreemptiveLLFScheduler : public PreemptiveScheduler {
+    public:
+        explicit PreemptiveLLFScheduler(std::vector<Task *> &tasks)
+            : PreemptiveScheduler(tasks) {
+        }
+
+        void run_scheduler(size_t nhyperperiods) override;
+    };
+
+    // Preemptive fixed-priority scheduling.
+    // The priority order is mapped onto dense priority levels (0 = highest) and the
+    // ready levels are kept in a containers::PriorityBitmap, so picking the highest
+    // ready task takes constant time regardless of the number of tasks.
+    class PreemptiveFixedPriorityScheduler : public PreemptiveScheduler {
+    public:
+        // * `pri_idx` lists task indices from highest priority to lowest.
+        PreemptiveFixedPriorityScheduler(std::vector<Task *> &tasks, const std::vector<size_t> &pri_idx);
+
+        void run_scheduler(size_t nhyperperiods) override;
+
+        [[nodiscard]] size_t get_priority_level(size_t task_idx) const { return pri_level.at(task_idx); }
+
+    protected:
+        // Priority level of each task, indexed as the task list.
+        std::vector<size_t> pri_level;
+    };
+
+    // Priorities as assigned by RateMonotonicScheduler.
+    class PreemptiveRMScheduler : public PreemptiveFixedPriorityScheduler {
+    public:
+        explicit PreemptiveRMScheduler(std::vector<Task *> &tasks);
+    };
+
+    // Priorities as assigned by DeadlineMonotonicScheduler.
+    class PreemptiveDMScheduler : public PreemptiveFixedPriorityScheduler {
+    public:
+        explicit PreemptiveDMScheduler(std::vector<Task *> &tasks);
+    };
+
+    using PEDF = PreemptiveEDFScheduler;
+    using PLLF = PreemptiveLLFScheduler;
+    using PRM = PreemptiveRMScheduler;
+    using PDM = PreemptiveDMScheduler;
+
+    enum class PreemptivePolicy { EDF, LLF, RM, DM };
+
+    [[nodiscard]] const char *to_string(PreemptivePolicy policy) noexcept;
+
+    std::unique_ptr<PreemptiveScheduler> make_preemptive_scheduler(std::vector<Task *> &tasks,
+                                                                   PreemptivePolicy policy);
+}
+
+#endif
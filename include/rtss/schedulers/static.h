@@ -1,12 +1,18 @@
 #ifndef RTSS_SCHEDULERS_CLOCK_BASED_H
 #define RTSS_SCHEDULERS_CLOCK_BASED_H
 
+#include <memory>
 #include <vector>
 
 #include "rtss/tasktable.h"
+#include "rtss/metrics/histogram.h"
 #include "rtss/schedulers/RTScheduler.h"
 
 namespace rtss::schedulers {
+    // Runs a precomputed table. The start of every slot (table entry or frame) is an absolute
+    // time of the run, counted from the start of the table in each hyperperiod, and the scheduler
+    // waits for that instant instead of sleeping for the length of the previous slot, so wake-up
+    // overshoot does not add up across slots and hyperperiods.
     class ClockBasedScheduler : public RTScheduler {
     public:
         ClockBasedScheduler(std::vector<Task *> &tasks,
@@ -16,8 +22,19 @@ namespace rtss::schedulers {
 
         void run_scheduler(size_t nperiods) override = 0;
 
+        // How late (in ns) each slot of the last run was dispatched after its nominal start.
+        // Always zero in virtual time.
+        [[nodiscard]] const metrics::HdrHistogram &get_dispatch_jitter() const noexcept { return dispatch_jitter; }
+
     protected:
         TaskTable &task_tbl;
+        metrics::HdrHistogram dispatch_jitter;
+
+        // Waits until `start` and records the dispatch lateness.
+        void wait_for_slot(time::TimeDuration start) {
+            this->sim_clock->advance_until(start);
+            dispatch_jitter.record(time::to_ns(this->sim_clock->now() - start));
+        }
     };
 
     class TableDrivenScheduler : public ClockBasedScheduler {
@@ -36,23 +53,48 @@ namespace rtss::schedulers {
 
     class CyclicExecutiveScheduler : public ClockBasedScheduler {
     public:
+        // * Runs the frames at the frame size the table was built with,
+        // * e.g. one picked by analysis::select_frame_size().
         explicit CyclicExecutiveScheduler(std::vector<Task *> tasks,
-                                          TaskTable &task_tbl,
-                                          int frame_sz)
-            : ClockBasedScheduler(tasks, task_tbl), frame_sz(frame_sz) {
+                                          TaskTable &task_tbl)
+            : ClockBasedScheduler(tasks, task_tbl) {
             if (task_tbl.scheduling_mode() != StaticSchedulingMode::FRAME_BASED) {
                 throw std::runtime_error(
                     "[CyclicExecutiveScheduler::CyclicExecutiveScheduler] TaskTable must be in FRAME_BASED mode");
             }
         }
 
-        // TODO: constructor that determines frame size automatically.
+        // * `frame_sz` (ms) must be the frame size the table was built with.
+        explicit CyclicExecutiveScheduler(std::vector<Task *> tasks,
+                                          TaskTable &task_tbl,
+                                          int frame_sz)
+            : CyclicExecutiveScheduler(tasks, task_tbl) {
+            if (task_tbl.get_frame_tm_dur() != time::createTimeDurationMs(frame_sz)) {
+                throw std::runtime_error(
+                    "[CyclicExecutiveScheduler::CyclicExecutiveScheduler] Frame size differs from the TaskTable's");
+            }
+        }
+
+        // * Takes ownership of the table.
+        explicit CyclicExecutiveScheduler(std::vector<Task *> tasks,
+                                          std::unique_ptr<TaskTable> task_tbl)
+            : CyclicExecutiveScheduler(tasks, *task_tbl) {
+            _owned_tbl = std::move(task_tbl);
+        }
 
         void run_scheduler(size_t nperiods) override;
 
+        [[nodiscard]] time::TimeDuration get_frame_size() const noexcept { return task_tbl.get_frame_tm_dur(); }
+
     private:
-        int frame_sz{0};
+        std::unique_ptr<TaskTable> _owned_tbl;
     };
+
+    // Builds the FRAME_BASED table of `builder` with the frame size picked by
+    // analysis::select_frame_size(tasks), and a cyclic executive that owns it.
+    // Throws std::runtime_error if no frame size satisfies the frame constraints.
+    std::unique_ptr<CyclicExecutiveScheduler> make_cyclic_executive(std::vector<Task *> &tasks,
+                                                                    TaskTableBuilder &builder);
 }
 
 #endif
@@ -0,0 +1,24 @@
+#ifndef RTSS_SCHEDULERS_TABLE_GENERATOR_H
+#define RTSS_SCHEDULERS_TABLE_GENERATOR_H
+
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/tasktable.h"
+#include "rtss/schedulers/preemptive.h"
+
+namespace rtss::schedulers {
+    // Offline schedule construction for TableDrivenScheduler and CyclicExecutiveScheduler.
+    // One hyperperiod of `tasks` is simulated under `policy` in virtual time, and every change
+    // of the running task is appended to `tbl_builder` as a TaskScheduleEntry: the task's
+    // position in the list (starting from 1), IDLE (0) when nothing is ready, and a final
+    // RESET (-1) at the hyperperiod.
+    // Returns the statistics of the simulated hyperperiod, so that deadline misses
+    // in the generated table can be detected.
+    // * The table describes [0, H) from time zero; with phased tasks the schedule of
+    // *  later hyperperiods can differ from the first one.
+    SimulationStats generate_task_table(std::vector<Task *> &tasks, PreemptivePolicy policy,
+                                        TaskTableBuilder &tbl_builder);
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include <thread>
 
 #include "rtss/time.h"
+#include "rtss/clock.h"
 
 namespace rtss {
     enum class TaskID {
@@ -43,7 +44,7 @@ namespace rtss {
             _rem_tm = rem_tm;
         }
 
-        void set_id(short id) {
+        void set_id(uint16_t id) {
             // !Set id only once when creating the task.
             if (_id == 0) {
                 _id = id;
@@ -68,8 +69,8 @@ namespace rtss {
             if (_id != 0) {
                 oss << "[T" << _id << "] ";
             }
-            oss << "phase = " << time::toInt(_phase)
-                    << " wcet = " << time::toInt(_wcet);
+            oss << "phase = " << time::to_string(_phase)
+                    << " wcet = " << time::to_string(_wcet);
             return oss.str();
         }
 
@@ -88,6 +89,13 @@ namespace rtss {
             std::this_thread::sleep_for(exec_time);
         }
 
+        // Same as run_task(exec_time), but lets the given clock account for the execution time,
+        // so that the task can be run in virtual time.
+        virtual void run_task(time::TimeDuration exec_time, time::SimClock &clock) {
+            update_rem_tm(exec_time);
+            clock.advance(exec_time);
+        }
+
     private:
         time::TimeDuration _phase{time::ZERO_DURATION}, _wcet{time::ZERO_DURATION};
         uint16_t _id{0};
@@ -127,16 +135,29 @@ namespace rtss {
         }
 
         [[nodiscard]] time::TimeDuration calc_abs_dl() const noexcept {
-            int64_t n_periods = time::toInt(time::Clock::now() + get_phase()) / time::toInt(_period);
+            int64_t n_periods = (time::from_clock(time::Clock::now().time_since_epoch()) + get_phase()) / _period;
             return get_phase() + (n_periods + 1) * _period + (_rel_dl - _period);
         }
 
         [[nodiscard]] time::TimeDuration calc_laxity() const noexcept {
             time::TimeDuration abs_dl = calc_abs_dl();
-            time::TimeDuration now = time::Clock::now().time_since_epoch();
+            time::TimeDuration now = time::from_clock(time::Clock::now().time_since_epoch());
             return abs_dl - now - get_rem_tm();
         }
 
+        // * `now` is the time elapsed since the start of the run (see time::SimClock).
+        [[nodiscard]] time::TimeDuration calc_abs_dl(time::TimeDuration now) const noexcept {
+            if (now < get_phase() || _period == time::ZERO_DURATION) {
+                return get_phase() + _rel_dl;
+            }
+            int64_t n_periods = (now - get_phase()) / _period;
+            return get_phase() + n_periods * _period + _rel_dl;
+        }
+
+        [[nodiscard]] time::TimeDuration calc_laxity(time::TimeDuration now) const noexcept {
+            return calc_abs_dl(now) - now - get_rem_tm();
+        }
+
         void set_period(const time::TimeDuration &period) noexcept {
             _period = period;
         }
@@ -150,10 +171,10 @@ namespace rtss {
             if (get_id() != 0) {
                 oss << "[T" << get_id() << "] ";
             }
-            oss << "phase = " << time::toInt(get_phase())
-                    << " period = " << time::toInt(_period)
-                    << " wcet = " << time::toInt(get_wcet())
-                    << " rel_dl = " << time::toInt(_rel_dl);
+            oss << "phase = " << time::to_string(get_phase())
+                    << " period = " << time::to_string(_period)
+                    << " wcet = " << time::to_string(get_wcet())
+                    << " rel_dl = " << time::to_string(_rel_dl);
             return oss.str();
         }
 
@@ -174,8 +195,8 @@ namespace rtss {
 
         [[nodiscard]] std::string to_string() const override {
             std::ostringstream oss;
-            oss << "arrival = " << time::toInt(get_arrival())
-                    << " wcet = " << time::toInt(get_wcet());
+            oss << "arrival = " << time::to_string(get_arrival())
+                    << " wcet = " << time::to_string(get_wcet());
             return oss.str();
         }
     };
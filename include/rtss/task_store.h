@@ -0,0 +1,61 @@
+#ifndef RTSS__TASK_STORE_H
+#define RTSS__TASK_STORE_H
+
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/time.h"
+
+namespace rtss {
+    // Owner of the tasks of one load, e.g. io::read_task_list_from_csv(TaskStore &, ...).
+    // Tasks are constructed one after the other in a monotonic arena rather than with one
+    // heap allocation each, so a reserved store keeps its tasks contiguous in load order, and
+    // release() (or the destructor) frees them all at once.
+    // * tasks() and the pointers in it stay valid until release(); the store cannot be moved,
+    // * so that frames and schedulers may keep a reference to tasks().
+    class TaskStore {
+    public:
+        // * Room for `ntasks` tasks in the first arena block.
+        explicit TaskStore(size_t ntasks = 0);
+
+        ~TaskStore();
+
+        TaskStore(const TaskStore &) = delete;
+
+        TaskStore &operator=(const TaskStore &) = delete;
+
+        TaskStore(TaskStore &&) = delete;
+
+        TaskStore &operator=(TaskStore &&) = delete;
+
+        // Resizes the first arena block to hold `ntasks` tasks; only while the store is empty.
+        void reserve(size_t ntasks);
+
+        // Both add the task to tasks() and return it.
+        PeriodicTask &add_periodic(time::TimeDuration phase, time::TimeDuration period, time::TimeDuration wcet,
+                                   time::TimeDuration rel_dl);
+
+        AperiodicTask &add_aperiodic(time::TimeDuration arrival, time::TimeDuration wcet);
+
+        // In the order they were added.
+        [[nodiscard]] const std::vector<Task *> &tasks() const noexcept { return _tasks; }
+
+        [[nodiscard]] size_t size() const noexcept { return _tasks.size(); }
+
+        [[nodiscard]] bool empty() const noexcept { return _tasks.empty(); }
+
+        // Destroys every task and returns the arena to the system.
+        void release() noexcept;
+
+    private:
+        std::optional<std::pmr::monotonic_buffer_resource> _arena;
+        std::vector<Task *> _tasks;
+
+        template<typename T, typename... Args>
+        T &emplace(Args &&... args);
+    };
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef RTSS_TASKSET_H
+#define RTSS_TASKSET_H
+
+#include <cstdint>
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/time.h"
+
+namespace rtss {
+    enum class TaskKind : uint8_t {
+        PERIODIC,
+        APERIODIC,
+        // Plain Task objects (e.g. Task::Idle()).
+        OTHER
+    };
+
+    // Task parameters as parallel arrays (structure of arrays), indexed as the task list.
+    // The schedulers' hot loops touch one or two parameters of many tasks, so keeping each
+    // parameter contiguous saves a pointer chase and a cache miss per task, and the kind
+    // tag replaces the dynamic_casts to PeriodicTask/AperiodicTask.
+    // * A TaskSet built from Task objects is a snapshot of their parameters.
+    class TaskSet {
+    public:
+        TaskSet() = default;
+
+        explicit TaskSet(const std::vector<Task *> &tasks);
+
+        void reserve(size_t n);
+
+        void clear() noexcept;
+
+        // Both return the index of the new task.
+        size_t add_periodic(time::TimeDuration phase, time::TimeDuration period, time::TimeDuration wcet,
+                            time::TimeDuration rel_dl, uint16_t id = 0);
+
+        size_t add_aperiodic(time::TimeDuration arrival, time::TimeDuration wcet, uint16_t id = 0);
+
+        [[nodiscard]] size_t size() const noexcept { return _kind.size(); }
+
+        [[nodiscard]] bool empty() const noexcept { return _kind.empty(); }
+
+        [[nodiscard]] TaskKind kind(size_t i) const noexcept { return _kind[i]; }
+
+        [[nodiscard]] bool is_periodic(size_t i) const noexcept { return _kind[i] == TaskKind::PERIODIC; }
+
+        [[nodiscard]] uint16_t id(size_t i) const noexcept { return _id[i]; }
+
+        [[nodiscard]] time::TimeDuration phase(size_t i) const noexcept { return _phase[i]; }
+
+        // Zero for non-periodic tasks.
+        [[nodiscard]] time::TimeDuration period(size_t i) const noexcept { return _period[i]; }
+
+        [[nodiscard]] time::TimeDuration wcet(size_t i) const noexcept { return _wcet[i]; }
+
+        // Zero for non-periodic tasks.
+        [[nodiscard]] time::TimeDuration rel_dl(size_t i) const noexcept { return _rel_dl[i]; }
+
+        [[nodiscard]] time::TimeDuration rem_tm(size_t i) const noexcept { return _rem_tm[i]; }
+
+        void set_rem_tm(size_t i, time::TimeDuration rem_tm) noexcept { _rem_tm[i] = rem_tm; }
+
+        // Restore the remaining time of every task to its WCET.
+        void reset() { _rem_tm = _wcet; }
+
+        // Same as PeriodicTask::calc_abs_dl(now) and PeriodicTask::calc_laxity(now).
+        [[nodiscard]] time::TimeDuration abs_dl(size_t i, time::TimeDuration now) const noexcept {
+            if (now < _phase[i] || _period[i] == time::ZERO_DURATION) {
+                return _phase[i] + _rel_dl[i];
+            }
+            int64_t n_periods = (now - _phase[i]) / _period[i];
+            return _phase[i] + n_periods * _period[i] + _rel_dl[i];
+        }
+
+        [[nodiscard]] time::TimeDuration laxity(size_t i, time::TimeDuration now) const noexcept {
+            return abs_dl(i, now) - now - _rem_tm[i];
+        }
+
+        // Whole columns, for loops over all tasks.
+        [[nodiscard]] const std::vector<TaskKind> &kinds() const noexcept { return _kind; }
+        [[nodiscard]] const std::vector<time::TimeDuration> &phases() const noexcept { return _phase; }
+        [[nodiscard]] const std::vector<time::TimeDuration> &periods() const noexcept { return _period; }
+        [[nodiscard]] const std::vector<time::TimeDuration> &wcets() const noexcept { return _wcet; }
+        [[nodiscard]] const std::vector<time::TimeDuration> &rel_dls() const noexcept { return _rel_dl; }
+        [[nodiscard]] const std::vector<time::TimeDuration> &rem_tms() const noexcept { return _rem_tm; }
+
+    private:
+        std::vector<TaskKind> _kind;
+        std::vector<uint16_t> _id;
+        std::vector<time::TimeDuration> _phase, _period, _wcet, _rel_dl, _rem_tm;
+
+        size_t push(TaskKind kind, uint16_t id, time::TimeDuration phase, time::TimeDuration period,
+                    time::TimeDuration wcet, time::TimeDuration rel_dl, time::TimeDuration rem_tm);
+    };
+}
+
+#endif
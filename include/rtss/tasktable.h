@@ -1,6 +1,7 @@
 #ifndef RTSS_TASKTBL_H
 #define RTSS_TASKTBL_H
 
+#include <memory>
 #include <string>
 
 #include "rtss/task.h"
@@ -31,22 +32,32 @@ namespace rtss {
             }
         }
 
-        explicit TaskTable(FrameContainer *frame_container, time::TimeDuration frame_tm_dur)
-            : _frame_container(frame_container),
-              _scheduling_mode(StaticSchedulingMode::FRAME_BASED), _frame_tm_dur(frame_tm_dur) {
+        // * Uses `n` entries that live outside the table, e.g. in a memory-mapped file,
+        // * without copying them. `storage` keeps them alive for as long as the table (or a copy of it) exists.
+        TaskTable(const TaskScheduleEntry *entries, size_t n, std::shared_ptr<const void> storage)
+            : _storage(std::move(storage)), _ext_entries(entries), _ext_size(n) {
+            if (_ext_entries == nullptr || _ext_size == 0) {
+                throw std::runtime_error("[TaskTable::TaskTable] Schedule is empty");
+            }
+        }
+
+        // * Copies of the table share the frames, which go with the last of them.
+        TaskTable(std::shared_ptr<const FrameContainer> frame_container, time::TimeDuration frame_tm_dur)
+            : _frame_container(std::move(frame_container)), _frame_tm_dur(frame_tm_dur),
+              _scheduling_mode(StaticSchedulingMode::FRAME_BASED) {
             if (_frame_tm_dur == time::ZERO_DURATION) {
                 throw std::runtime_error("[TaskTable::TaskTable] Frame size cannot be zero");
             }
-            if (_frame_container->empty()) {
+            if (_frame_container == nullptr || _frame_container->empty()) {
                 throw std::runtime_error("[TaskTable::TaskTable] Frames are empty");
             }
         }
 
         [[nodiscard]] const TaskScheduleEntry &get_kth_entry(size_t k) const {
-            if (k >= _schedule.size()) {
+            if (k >= entry_count()) {
                 throw std::out_of_range("[TaskTable::get_kth_entry] Index out of range");
             }
-            return _schedule[k];
+            return entry_data()[k];
         }
 
         [[nodiscard]] const Frame &get_kth_frame(size_t k) const {
@@ -61,10 +72,10 @@ namespace rtss {
         }
 
         [[nodiscard]] const TaskScheduleEntry &get_current_entry() const {
-            if (_schedule.empty()) {
+            if (entry_count() == 0) {
                 throw std::runtime_error("[TaskTable::get_current_entry] TaskTable is empty");
             }
-            return _schedule[_k];
+            return entry_data()[_k];
         }
 
         [[nodiscard]] const Frame &get_current_frame() const {
@@ -79,10 +90,10 @@ namespace rtss {
         }
 
         [[nodiscard]] const TaskScheduleEntry &get_next_entry() const {
-            if (_schedule.empty()) {
+            if (entry_count() == 0) {
                 throw std::runtime_error("[TaskTable::get_next_entry] TaskTable is empty");
             }
-            return _schedule[(_k + 1) % _schedule.size()];
+            return entry_data()[(_k + 1) % entry_count()];
         }
 
         [[nodiscard]] const Frame &get_next_frame() const {
@@ -98,7 +109,7 @@ namespace rtss {
 
         void increment_k() noexcept {
             if (_scheduling_mode == StaticSchedulingMode::TASK_BASED) {
-                _k = (_k + 1) % _schedule.size();
+                _k = (_k + 1) % entry_count();
             } else if (_scheduling_mode == StaticSchedulingMode::FRAME_BASED) {
                 _k = (_k + 1) % _frame_container->size();
             }
@@ -107,7 +118,7 @@ namespace rtss {
         [[nodiscard]] size_t size() const noexcept {
             switch (_scheduling_mode) {
                 case StaticSchedulingMode::TASK_BASED:
-                    return _schedule.size();
+                    return entry_count();
                 case StaticSchedulingMode::FRAME_BASED:
                     return _frame_container->size();
                 default:
@@ -120,8 +131,9 @@ namespace rtss {
                 case StaticSchedulingMode::TASK_BASED: {
                     std::ostringstream oss;
                     oss << "t_k\tT_k: \n";
-                    for (auto schedule_entry: _schedule) {
-                        oss << time::toInt(schedule_entry.start_time) << "\t" << schedule_entry.task_id << "\n";
+                    for (size_t k = 0; k < entry_count(); k++) {
+                        const TaskScheduleEntry &schedule_entry = entry_data()[k];
+                        oss << time::to_string(schedule_entry.start_time) << "\t" << schedule_entry.task_id << "\n";
                     }
                     return oss.str();
                 }
@@ -138,12 +150,32 @@ namespace rtss {
 
         [[nodiscard]] size_t get_k() const noexcept { return _k; }
 
+        [[nodiscard]] time::TimeDuration get_frame_tm_dur() const noexcept { return _frame_tm_dur; }
+
+        // True if the entries are used in place from external storage rather than owned.
+        [[nodiscard]] bool is_external() const noexcept { return _ext_entries != nullptr; }
+
+        // * Created by TaskTableBuilder::build() in FRAME_BASED mode, nullptr otherwise.
+        [[nodiscard]] const FrameContainer *get_frame_container() const noexcept { return _frame_container.get(); }
+
     private:
         size_t _k{0};
         const std::vector<TaskScheduleEntry> _schedule;
-        const FrameContainer *const _frame_container{nullptr};
+        // Set instead of _schedule when the entries live elsewhere.
+        std::shared_ptr<const void> _storage;
+        const TaskScheduleEntry *_ext_entries{nullptr};
+        size_t _ext_size{0};
+        const std::shared_ptr<const FrameContainer> _frame_container;
         time::TimeDuration _frame_tm_dur{time::ZERO_DURATION};
         StaticSchedulingMode _scheduling_mode{StaticSchedulingMode::TASK_BASED};
+
+        [[nodiscard]] const TaskScheduleEntry *entry_data() const noexcept {
+            return _ext_entries != nullptr ? _ext_entries : _schedule.data();
+        }
+
+        [[nodiscard]] size_t entry_count() const noexcept {
+            return _ext_entries != nullptr ? _ext_size : _schedule.size();
+        }
     };
 
     class TaskTableBuilder {
@@ -171,24 +203,41 @@ namespace rtss {
                     if (tasks.empty()) {
                         throw std::runtime_error("[TaskTableBuilder::build] Tasks reference is empty");
                     }
-                    FrameContainer *frame_container = this->create_frames(frame_tm_dur, tasks);
-                    if (frame_container == nullptr || frame_container->empty()) {
+                    auto frame_container = std::make_shared<const FrameContainer>(
+                        tasks, this->create_frames(frame_tm_dur), frame_tm_dur);
+                    if (frame_container->empty()) {
                         throw std::runtime_error("[TaskTableBuilder::build] Failed to create frames");
                     }
-                    return TaskTable(frame_container, _frame_tm_dur);
+                    return TaskTable(std::move(frame_container), _frame_tm_dur);
                 }
                 default:
                     throw std::runtime_error("[TaskTableBuilder::build] Invalid StaticSchedulingMode");
             }
         }
 
+        // Takes the buffer over instead of copying it when the builder is still empty.
+        void append(std::vector<TaskScheduleEntry> &&entries) {
+            if (_schedule.empty()) {
+                _schedule = std::move(entries);
+            } else {
+                _schedule.insert(_schedule.end(), entries.begin(), entries.end());
+            }
+        }
+
+        void reserve(size_t n) { _schedule.reserve(n); }
+
+        void clear() noexcept { _schedule.clear(); }
+
         [[nodiscard]] size_t size() const noexcept { return _schedule.size(); }
 
+        [[nodiscard]] const std::vector<TaskScheduleEntry> &entries() const noexcept { return _schedule; }
+
     private:
         std::vector<TaskScheduleEntry> _schedule;
         time::TimeDuration _frame_tm_dur{time::ZERO_DURATION};
 
-        FrameContainer *create_frames(time::TimeDuration frame_tm_dur, const std::vector<Task *> &tasks);
+        // Splits the schedule into frames of `frame_tm_dur`.
+        std::vector<Frame> create_frames(time::TimeDuration frame_tm_dur);
     };
 }
 
@@ -1,20 +1,42 @@
 #ifndef RTSS__TIME_H
 #define RTSS__TIME_H
 
+#include <charconv>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <string>
+#include <string_view>
+#include <system_error>
 
-// Use milliseconds for now.
-
+// Resolution of time::TimeDuration in nanoseconds: 1 (ns), 1000 (us) or 1000000 (ms).
+// Set at configure time with -DRTSS_TIME_TICK_NS=...
+#ifndef RTSS_TIME_TICK_NS
+#define RTSS_TIME_TICK_NS 1
+#endif
 
 namespace rtss::time {
+    // Every time in the library is a 64-bit count of ticks. Durations of the same type add,
+    // compare and divide as plain integers, so the simulation never converts between units;
+    // conversions happen only at the edges (input, output, the wall clock).
+    using Tick = int64_t;
+    constexpr Tick TICK_NS = RTSS_TIME_TICK_NS;
+    static_assert(TICK_NS == 1 || TICK_NS == 1'000 || TICK_NS == 1'000'000,
+                  "RTSS_TIME_TICK_NS must be 1 (ns), 1000 (us) or 1000000 (ms)");
+
+    using TimeDuration = std::chrono::duration<Tick, std::ratio<TICK_NS, 1'000'000'000>::type>;
+    // Wall clock; its own durations are nanoseconds whatever the tick is.
     using Clock = std::chrono::steady_clock;
-    using TimeDuration = Clock::duration;
     using TimePoint = Clock::time_point;
 
-    inline TimeDuration createTimeDurationMs(int ms) {
+    inline constexpr TimeDuration ticks(Tick n) noexcept { return TimeDuration(n); }
+
+    inline constexpr TimeDuration createTimeDurationMs(int64_t ms) {
         return std::chrono::milliseconds(ms);
     }
 
+    // Whole milliseconds, truncated.
     inline int64_t toInt(const TimeDuration &td) {
         return std::chrono::duration_cast<std::chrono::milliseconds>(td).count();
     }
@@ -23,8 +45,85 @@ namespace rtss::time {
         return std::chrono::duration_cast<std::chrono::milliseconds>(td.time_since_epoch()).count();
     }
 
+    // Nanoseconds, the unit of the event log, traces and metrics.
+    inline constexpr int64_t to_ns(TimeDuration td) noexcept { return td.count() * TICK_NS; }
+
+    // Tick count of a wall-clock duration, truncated.
+    inline constexpr TimeDuration from_clock(Clock::duration d) noexcept {
+        return std::chrono::duration_cast<TimeDuration>(d);
+    }
+
     const TimeDuration ZERO_DURATION = TimeDuration::zero();
 
+    // Longest text put_duration() writes: 20 characters of int64_t and a suffix.
+    constexpr size_t MAX_DURATION_SZ = 22;
+
+    // Writes `ns` nanoseconds in the coarsest of "ms", "us" and "ns" that is exact, e.g. "5ms"
+    // or "250us", which parse_duration() reads back. Returns the end of the text, or `p` with
+    // nothing written if [p, end) is too short; MAX_DURATION_SZ characters always suffice.
+    inline char *put_duration_ns(char *p, char *end, int64_t ns) noexcept {
+        const char *unit = "ns";
+        if (ns % 1'000'000 == 0) {
+            ns /= 1'000'000;
+            unit = "ms";
+        } else if (ns % 1'000 == 0) {
+            ns /= 1'000;
+            unit = "us";
+        }
+        const auto [num_end, ec] = std::to_chars(p, end, ns);
+        if (ec != std::errc() || end - num_end < 2) return p;
+        num_end[0] = unit[0];
+        num_end[1] = unit[1];
+        return num_end + 2;
+    }
+
+    inline char *put_duration(char *p, char *end, TimeDuration d) noexcept {
+        return put_duration_ns(p, end, to_ns(d));
+    }
+
+    // For messages and printouts; sub-millisecond times keep their precision.
+    inline std::string to_string(TimeDuration d) {
+        char buf[MAX_DURATION_SZ];
+        return std::string(buf, put_duration(buf, buf + sizeof(buf), d));
+    }
+
+    // Parses an integer with an optional unit suffix, "ns", "us", "ms" or "s" (e.g. "250us");
+    // a bare number is in milliseconds. Fails on an unknown suffix, on a value that is not a
+    // whole number of ticks, and on overflow.
+    inline bool parse_duration(std::string_view text, TimeDuration &out) noexcept {
+        size_t pos = 0;
+        const bool negative = !text.empty() && text[0] == '-';
+        if (negative || (!text.empty() && text[0] == '+')) pos++;
+        if (pos == text.size() || text[pos] < '0' || text[pos] > '9') return false;
+        int64_t value = 0;
+        for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; pos++) {
+            if (__builtin_mul_overflow(value, 10, &value) || __builtin_add_overflow(value, text[pos] - '0', &value)) {
+                return false;
+            }
+        }
+        const std::string_view suffix = text.substr(pos);
+        int64_t unit_ns;
+        if (suffix.empty() || suffix == "ms") {
+            unit_ns = 1'000'000;
+        } else if (suffix == "us") {
+            unit_ns = 1'000;
+        } else if (suffix == "ns") {
+            unit_ns = 1;
+        } else if (suffix == "s") {
+            unit_ns = 1'000'000'000;
+        } else {
+            return false;
+        }
+        Tick n;
+        if (unit_ns >= TICK_NS) {
+            if (__builtin_mul_overflow(value, unit_ns / TICK_NS, &n)) return false;
+        } else {
+            if (value % (TICK_NS / unit_ns) != 0) return false;
+            n = value / (TICK_NS / unit_ns);
+        }
+        out = TimeDuration(negative ? -n : n);
+        return true;
+    }
 }
 
 
@@ -0,0 +1,94 @@
+#ifndef RTSS_TRACE_CHROME_TRACE_H
+#define RTSS_TRACE_CHROME_TRACE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "rtss/schedulers/observer.h"
+#include "rtss/task.h"
+
+namespace rtss::trace {
+    // Writes a run as a Chrome Trace Event JSON file, which chrome://tracing and
+    // ui.perfetto.dev open directly.
+    // The "CPUs" process has one track per core showing which task runs when; the "Tasks"
+    // process has one track per task with its execution slices and release, deadline,
+    // preemption, migration and deadline-miss markers. Core tracks are added as the cores
+    // are first used, so the writer works the same for one core or many.
+    // Events are written as the scheduler reports them through a 64 KiB buffer, so memory
+    // stays constant however long the run is.
+    class ChromeTraceWriter : public schedulers::SchedulerObserver {
+    public:
+        // * `tasks` names the task tracks (T<id>); only its size and ids are used.
+        ChromeTraceWriter(const std::filesystem::path &path, const std::vector<Task *> &tasks);
+
+        // Finishes the file if on_finish() has not been called.
+        ~ChromeTraceWriter() override;
+
+        ChromeTraceWriter(const ChromeTraceWriter &) = delete;
+
+        ChromeTraceWriter &operator=(const ChromeTraceWriter &) = delete;
+
+        void on_release(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) override;
+
+        void on_dispatch(time::TimeDuration t, size_t task_idx, size_t core) override;
+
+        void on_preempt(time::TimeDuration t, size_t task_idx) override;
+
+        void on_migrate(time::TimeDuration t, size_t task_idx, size_t from_core, size_t to_core) override;
+
+        void on_complete(time::TimeDuration t, size_t task_idx, time::TimeDuration release,
+                         time::TimeDuration abs_dl) override;
+
+        void on_deadline_miss(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) override;
+
+        // Closes the last slice and the JSON document; the writer accepts no events after this.
+        void on_finish(time::TimeDuration t) override;
+
+        [[nodiscard]] size_t events_written() const noexcept { return _nevents; }
+
+    private:
+        static constexpr size_t BLOCK_SZ = 1 << 16;
+
+        std::filesystem::path _path;
+        std::ofstream _ofs;
+        std::string _buf;
+        std::vector<int32_t> _task_ids;
+        size_t _nevents{0};
+        bool _finished{false};
+
+        // Slice being run on each core used so far, if any.
+        std::vector<size_t> _running;
+        std::vector<time::TimeDuration> _running_since;
+
+        void check_open(const char *fn) const;
+
+        void name_process(int pid, const char *name);
+
+        void name_track(int pid, int64_t tid, const char *prefix, int64_t n);
+
+        // Names the track of `core` and of every core below it not named yet.
+        void add_core(size_t core);
+
+        void close_slice(size_t core, time::TimeDuration t);
+
+        // Starts an event object with the fields every event has; the caller appends the rest and '}'.
+        void begin_event(const char *ph, int pid, int64_t tid, const char *name, const char *cat,
+                         time::TimeDuration ts);
+
+        void append(const char *s);
+
+        void append_int(int64_t v);
+
+        // ns as microseconds with three decimals, the unit of "ts" and "dur".
+        void append_us(time::TimeDuration d);
+
+        void end_event();
+
+        void write_block(bool force);
+    };
+}
+
+#endif
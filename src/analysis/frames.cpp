@@ -0,0 +1,116 @@
+#include "rtss/analysis/frames.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <thread>
+
+#include "rtss/analysis/hyperperiod.h"
+
+namespace rtss::analysis {
+    namespace {
+        // Below this many gcd evaluations a single thread is faster than spawning more.
+        constexpr size_t PARALLEL_THRESHOLD = 1 << 16;
+
+        void factorise(int64_t x, std::map<int64_t, int> &max_exp) {
+            for (int64_t p = 2; p * p <= x; p += (p == 2 ? 1 : 2)) {
+                int e = 0;
+                while (x % p == 0) {
+                    x /= p;
+                    e++;
+                }
+                if (e > 0) max_exp[p] = std::max(max_exp[p], e);
+            }
+            if (x > 1) max_exp[x] = std::max(max_exp[x], 1);
+        }
+
+        // Divisors of the number with the given factorisation that lie in [lo, hi].
+        void divisors_in_range(const std::vector<std::pair<int64_t, int> > &factors, size_t k, int64_t d,
+                               int64_t lo, int64_t hi, std::vector<int64_t> &out) {
+            if (k == factors.size()) {
+                if (d >= lo) out.push_back(d);
+                return;
+            }
+            auto [p, e] = factors[k];
+            for (int i = 0; i <= e; i++) {
+                divisors_in_range(factors, k + 1, d, lo, hi, out);
+                if (i == e || d > hi / p) break;
+                d *= p;
+            }
+        }
+    }
+
+    FrameSizeSelection select_frame_size(const std::vector<Task *> &tasks, const FrameCost &cost,
+                                         size_t nthreads) {
+        FrameSizeSelection selection;
+        selection.hyperperiod = hyperperiod(tasks);
+        const int64_t H = selection.hyperperiod.count();
+        if (H == 0) return selection;
+
+        // Only the tightest deadline of each period matters for the third constraint.
+        std::map<int64_t, int64_t> min_dl;
+        int64_t max_wcet = 1;
+        for (auto *T: tasks) {
+            auto *P = dynamic_cast<PeriodicTask *>(T);
+            if (P == nullptr || P->get_period() <= time::ZERO_DURATION) continue;
+            int64_t p = P->get_period().count(), d = P->get_rel_dl().count();
+            auto it = min_dl.find(p);
+            min_dl[p] = it == min_dl.end() ? d : std::min(it->second, d);
+            max_wcet = std::max(max_wcet, P->get_wcet().count());
+        }
+        std::vector<int64_t> period, rel_dl;
+        int64_t d_min = INT64_MAX;
+        for (auto [p, d]: min_dl) {
+            period.push_back(p);
+            rel_dl.push_back(d);
+            d_min = std::min(d_min, d);
+        }
+
+        std::map<int64_t, int> max_exp;
+        for (int64_t p: period) factorise(p, max_exp);
+        std::vector<std::pair<int64_t, int> > factors(max_exp.begin(), max_exp.end());
+        // 2f - gcd(f, p) <= D and gcd(f, p) <= f give f <= D_min.
+        std::vector<int64_t> divisors;
+        divisors_in_range(factors, 0, 1, max_wcet, d_min, divisors);
+        std::sort(divisors.begin(), divisors.end());
+
+        std::vector<char> valid(divisors.size(), 0);
+        auto check = [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; c++) {
+                const int64_t f = divisors[c];
+                bool ok = true;
+                for (size_t i = 0; i < period.size() && ok; i++) {
+                    ok = 2 * f - std::gcd(f, period[i]) <= rel_dl[i];
+                }
+                valid[c] = ok;
+            }
+        };
+        if (nthreads == 0) {
+            nthreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        if (nthreads == 1 || divisors.size() * period.size() < PARALLEL_THRESHOLD) {
+            check(0, divisors.size());
+        } else {
+            nthreads = std::min(nthreads, divisors.size());
+            std::vector<std::thread> workers;
+            const size_t chunk = (divisors.size() + nthreads - 1) / nthreads;
+            for (size_t begin = 0; begin < divisors.size(); begin += chunk) {
+                workers.emplace_back(check, begin, std::min(begin + chunk, divisors.size()));
+            }
+            for (auto &w: workers) w.join();
+        }
+
+        double best_cost = 0;
+        for (size_t c = 0; c < divisors.size(); c++) {
+            if (!valid[c]) continue;
+            time::TimeDuration f(divisors[c]);
+            selection.candidates.push_back(f);
+            double fc = cost(f, selection.hyperperiod);
+            if (!selection.found() || fc < best_cost) {
+                selection.best = f;
+                best_cost = fc;
+            }
+        }
+        return selection;
+    }
+}
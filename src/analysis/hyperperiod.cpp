@@ -0,0 +1,23 @@
+#include "rtss/analysis/hyperperiod.h"
+
+#include <stdexcept>
+
+namespace rtss::analysis {
+    time::TimeDuration hyperperiod(const std::vector<Task *> &tasks) {
+        return hyperperiod(TaskSet(tasks));
+    }
+
+    time::TimeDuration hyperperiod(const TaskSet &task_set) {
+        int64_t H = 0;
+        for (size_t i = 0; i < task_set.size(); i++) {
+            if (!task_set.is_periodic(i) || task_set.period(i) <= time::ZERO_DURATION) continue;
+            int64_t p = task_set.period(i).count();
+            if (H == 0) {
+                H = p;
+            } else if (!checked_lcm(H, p, H)) {
+                throw std::overflow_error("[analysis::hyperperiod] Hyperperiod overflows 64 bits");
+            }
+        }
+        return time::TimeDuration(H);
+    }
+}
@@ -0,0 +1,189 @@
+#include "rtss/analysis/partition.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#include "rtss/analysis/qpa.h"
+#include "rtss/analysis/rta.h"
+
+namespace rtss::analysis {
+    namespace {
+        // Slack for the utilisation sums, which are rounded; closer calls go to the exact test.
+        constexpr double U_EPS = 1e-9;
+
+        // Tasks on one core and the running totals the utilisation bounds need.
+        struct Core {
+            // Task indices in ascending order, so the local order matches the task list
+            // and priority ties break the same way as in the task list.
+            std::vector<size_t> members;
+            double utilisation{0};
+            // prod(U_i + 1), for the hyperbolic bound.
+            double hyperbolic{1};
+            // Every deadline equals the period (RM/DM bound) or is at least it (EDF bound).
+            bool implicit{true};
+            bool unconstrained{true};
+        };
+
+        class Acceptor {
+        public:
+            Acceptor(const std::vector<PeriodicTask *> &tasks, AcceptanceTest test)
+                : _tasks(tasks), _test(test) {
+            }
+
+            // Whether `core` can take task i, and how many exact tests that took.
+            bool accepts(const Core &core, size_t i, double u, size_t &exact_tests) {
+                const PeriodicTask *P = _tasks[i];
+                const double total = core.utilisation + u;
+                if (total > 1 + U_EPS) return false;
+                if (_test == AcceptanceTest::EDF) {
+                    if (core.unconstrained && P->get_rel_dl() >= P->get_period() && total <= 1 - U_EPS) return true;
+                } else if (core.implicit && P->get_rel_dl() == P->get_period() &&
+                           core.hyperbolic * (u + 1) <= 2 - U_EPS) {
+                    return true;
+                }
+
+                exact_tests++;
+                _candidate.clear();
+                bool placed = false;
+                for (size_t j: core.members) {
+                    if (!placed && i < j) {
+                        _candidate.push_back(_tasks[i]);
+                        placed = true;
+                    }
+                    _candidate.push_back(_tasks[j]);
+                }
+                if (!placed) _candidate.push_back(_tasks[i]);
+
+                if (_test == AcceptanceTest::EDF) {
+                    return qpa_edf(_candidate).feasible;
+                }
+                // Same order as RateMonotonicScheduler / DeadlineMonotonicScheduler: by key,
+                // ties to the lower index.
+                _pri_idx.resize(_candidate.size());
+                std::iota(_pri_idx.begin(), _pri_idx.end(), 0);
+                auto key = [&](size_t k) {
+                    const auto *T = static_cast<PeriodicTask *>(_candidate[k]);
+                    return _test == AcceptanceTest::RM ? T->get_period() : T->get_rel_dl();
+                };
+                std::stable_sort(_pri_idx.begin(), _pri_idx.end(), [&](size_t a, size_t b) { return key(a) < key(b); });
+                return response_time_analysis(_candidate, _pri_idx).schedulable;
+            }
+
+        private:
+            const std::vector<PeriodicTask *> &_tasks;
+            AcceptanceTest _test;
+            // Scratch space reused across candidates.
+            std::vector<Task *> _candidate;
+            std::vector<size_t> _pri_idx;
+        };
+    }
+
+    const char *to_string(FitHeuristic heuristic) noexcept {
+        switch (heuristic) {
+            case FitHeuristic::FIRST_FIT: return "FF";
+            case FitHeuristic::BEST_FIT: return "BF";
+            case FitHeuristic::WORST_FIT: return "WF";
+            case FitHeuristic::FIRST_FIT_DECREASING: return "FFD";
+            case FitHeuristic::BEST_FIT_DECREASING: return "BFD";
+            case FitHeuristic::WORST_FIT_DECREASING: return "WFD";
+            default: return "?";
+        }
+    }
+
+    const char *to_string(AcceptanceTest test) noexcept {
+        switch (test) {
+            case AcceptanceTest::RM: return "RM";
+            case AcceptanceTest::DM: return "DM";
+            case AcceptanceTest::EDF: return "EDF";
+            default: return "?";
+        }
+    }
+
+    std::string Partition::to_string(const std::vector<Task *> &tasks) const {
+        std::ostringstream oss;
+        for (size_t c = 0; c < tasks_on.size(); c++) {
+            oss << "core " << c << ":";
+            for (size_t i: tasks_on[c]) {
+                oss << " T" << tasks.at(i)->get_id();
+            }
+            oss << " (U = " << std::fixed << std::setprecision(3) << utilisation[c] << ")\n";
+        }
+        if (unassigned > 0) {
+            oss << "unassigned:";
+            for (size_t i = 0; i < core_of.size(); i++) {
+                if (core_of[i] == UNASSIGNED) oss << " T" << tasks.at(i)->get_id();
+            }
+            oss << "\n";
+        }
+        return oss.str();
+    }
+
+    Partition partition_tasks(const std::vector<Task *> &tasks, size_t ncores, FitHeuristic heuristic,
+                              AcceptanceTest test) {
+        if (ncores == 0) {
+            throw std::runtime_error("[analysis::partition_tasks] Core count cannot be zero");
+        }
+        const size_t n = tasks.size();
+        std::vector<PeriodicTask *> periodic(n);
+        std::vector<double> u(n);
+        for (size_t i = 0; i < n; i++) {
+            auto *P = dynamic_cast<PeriodicTask *>(tasks[i]);
+            if (P == nullptr || P->get_period() <= time::ZERO_DURATION) {
+                throw std::runtime_error("[analysis::partition_tasks] Only periodic tasks can be partitioned");
+            }
+            periodic[i] = P;
+            u[i] = static_cast<double>(P->get_wcet().count()) / static_cast<double>(P->get_period().count());
+        }
+
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        const bool decreasing = heuristic == FitHeuristic::FIRST_FIT_DECREASING ||
+                                heuristic == FitHeuristic::BEST_FIT_DECREASING ||
+                                heuristic == FitHeuristic::WORST_FIT_DECREASING;
+        if (decreasing) {
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return u[a] > u[b]; });
+        }
+        const bool best = heuristic == FitHeuristic::BEST_FIT || heuristic == FitHeuristic::BEST_FIT_DECREASING;
+        const bool worst = heuristic == FitHeuristic::WORST_FIT || heuristic == FitHeuristic::WORST_FIT_DECREASING;
+
+        Partition result;
+        result.core_of.assign(n, Partition::UNASSIGNED);
+        std::vector<Core> cores(ncores);
+        std::vector<size_t> tried(ncores);
+        Acceptor acceptor(periodic, test);
+
+        for (size_t i: order) {
+            std::iota(tried.begin(), tried.end(), 0);
+            if (best || worst) {
+                std::stable_sort(tried.begin(), tried.end(), [&](size_t a, size_t b) {
+                    return best ? cores[a].utilisation > cores[b].utilisation
+                                : cores[a].utilisation < cores[b].utilisation;
+                });
+            }
+            for (size_t c: tried) {
+                Core &core = cores[c];
+                if (!acceptor.accepts(core, i, u[i], result.exact_tests)) continue;
+                core.members.insert(std::upper_bound(core.members.begin(), core.members.end(), i), i);
+                core.utilisation += u[i];
+                core.hyperbolic *= u[i] + 1;
+                core.implicit = core.implicit && periodic[i]->get_rel_dl() == periodic[i]->get_period();
+                core.unconstrained = core.unconstrained && periodic[i]->get_rel_dl() >= periodic[i]->get_period();
+                result.core_of[i] = c;
+                break;
+            }
+            if (result.core_of[i] == Partition::UNASSIGNED) result.unassigned++;
+        }
+
+        result.feasible = result.unassigned == 0;
+        result.tasks_on.resize(ncores);
+        result.utilisation.resize(ncores);
+        for (size_t c = 0; c < ncores; c++) {
+            result.tasks_on[c] = std::move(cores[c].members);
+            result.utilisation[c] = cores[c].utilisation;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,146 @@
+#include "rtss/analysis/qpa.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "rtss/analysis/arith.h"
+
+namespace rtss::analysis {
+    namespace {
+        constexpr int64_t SATURATED = std::numeric_limits<int64_t>::max();
+
+        struct DemandTasks {
+            std::vector<int64_t> wcet, period, rel_dl;
+            bool phased{false};
+
+            explicit DemandTasks(const std::vector<Task *> &tasks) {
+                bool first = true;
+                time::TimeDuration phase0 = time::ZERO_DURATION;
+                for (auto *T: tasks) {
+                    auto *P = dynamic_cast<PeriodicTask *>(T);
+                    if (P == nullptr || P->get_period() <= time::ZERO_DURATION) continue;
+                    wcet.push_back(P->get_wcet().count());
+                    period.push_back(P->get_period().count());
+                    rel_dl.push_back(P->get_rel_dl().count());
+                    if (first) {
+                        phase0 = P->get_phase();
+                        first = false;
+                    } else if (P->get_phase() != phase0) {
+                        phased = true;
+                    }
+                }
+            }
+
+            [[nodiscard]] size_t size() const noexcept { return wcet.size(); }
+
+            [[nodiscard]] int64_t h(int64_t t) const noexcept {
+                int64_t demand = 0;
+                for (size_t i = 0; i < size(); i++) {
+                    if (t < rel_dl[i]) continue;
+                    int64_t n_jobs = (t - rel_dl[i]) / period[i] + 1;
+                    demand = sat_add(demand, sat_mul(n_jobs, wcet[i]));
+                }
+                return demand;
+            }
+
+            // Largest absolute deadline strictly before t; -1 if there is none.
+            [[nodiscard]] int64_t prev_deadline(int64_t t) const noexcept {
+                int64_t d = -1;
+                for (size_t i = 0; i < size(); i++) {
+                    if (rel_dl[i] >= t) continue;
+                    int64_t k = (t - 1 - rel_dl[i]) / period[i];
+                    d = std::max(d, k * period[i] + rel_dl[i]);
+                }
+                return d;
+            }
+
+            // Length of the synchronous busy period; SATURATED if it does not fit.
+            [[nodiscard]] int64_t busy_period() const noexcept {
+                int64_t w = 0;
+                for (int64_t c: wcet) w = sat_add(w, c);
+                while (w != SATURATED) {
+                    int64_t next = 0;
+                    for (size_t i = 0; i < size(); i++) {
+                        next = sat_add(next, sat_mul(ceil_div(w, period[i]), wcet[i]));
+                    }
+                    if (next == w) break;
+                    w = next;
+                }
+                return w;
+            }
+        };
+    }
+
+    time::TimeDuration demand_bound(const std::vector<Task *> &tasks, time::TimeDuration t) {
+        return time::TimeDuration(DemandTasks(tasks).h(t.count()));
+    }
+
+    QPAResult qpa_edf(const std::vector<Task *> &tasks) {
+        QPAResult result;
+        DemandTasks dt(tasks);
+        if (dt.size() == 0) return result;
+
+        long double U = 0;
+        bool deadlines_at_least_periods = true;
+        int64_t d_min = SATURATED;
+        long double la = 0;
+        for (size_t i = 0; i < dt.size(); i++) {
+            long double u = static_cast<long double>(dt.wcet[i]) / dt.period[i];
+            U += u;
+            deadlines_at_least_periods = deadlines_at_least_periods && dt.rel_dl[i] >= dt.period[i];
+            d_min = std::min(d_min, dt.rel_dl[i]);
+            la = std::max(la, static_cast<long double>(dt.rel_dl[i] - dt.period[i]));
+        }
+        result.utilisation = U;
+        // Tolerance for the rounding of the floating-point sum; U = 1 exactly takes the busy-period bound.
+        constexpr long double EPS = 1e-12L;
+        if (U > 1 + EPS) {
+            result.feasible = false;
+            return result;
+        }
+        if (deadlines_at_least_periods) {
+            return result;
+        }
+
+        // L = min(L_a, L_b), L_a only being valid for U < 1.
+        int64_t L = dt.busy_period();
+        if (U < 1 - EPS) {
+            long double sum = 0;
+            for (size_t i = 0; i < dt.size(); i++) {
+                sum += static_cast<long double>(dt.period[i] - dt.rel_dl[i]) * dt.wcet[i] / dt.period[i];
+            }
+            la = std::max(la, sum / (1 - U));
+            if (la < static_cast<long double>(L)) {
+                L = static_cast<int64_t>(std::ceil(la));
+            }
+        }
+        if (L == SATURATED) {
+            // U is 1 within rounding and the busy period does not fit: report the overflow as a failure.
+            result.feasible = false;
+            result.exact = false;
+            return result;
+        }
+
+        int64_t t = dt.prev_deadline(L);
+        if (t < 0) return result;
+        int64_t h = dt.h(t);
+        result.iterations++;
+        while (h <= t && h > d_min) {
+            if (h < t) {
+                t = h;
+            } else {
+                t = dt.prev_deadline(t);
+                if (t < 0) break;
+            }
+            h = dt.h(t);
+            result.iterations++;
+        }
+        if (t >= 0 && h > d_min) {
+            result.feasible = false;
+            result.failure_point = time::TimeDuration(t);
+            result.exact = !dt.phased;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,162 @@
+#include "rtss/analysis/rta.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "rtss/analysis/arith.h"
+#include "rtss/containers/indexed_heap.h"
+
+namespace rtss::analysis {
+    namespace {
+        // Interference I(w) = sum_j ceil((w + J_j) / T_j) C_j of the higher-priority tasks.
+        // The job count of each task is kept in a heap together with the largest w it holds for,
+        // so moving w forward only touches the tasks that gain a job. Busy windows grow down the
+        // priority order, so the counts carry over from one task to the next.
+        class Interference {
+        public:
+            explicit Interference(size_t capacity)
+                : _thresholds(capacity) {
+                _wcet.reserve(capacity);
+                _period.reserve(capacity);
+                _jitter.reserve(capacity);
+                _njobs.reserve(capacity);
+            }
+
+            void add_task(int64_t C, int64_t T, int64_t J) {
+                size_t j = _wcet.size();
+                _wcet.push_back(C);
+                _period.push_back(T);
+                _jitter.push_back(J);
+                _njobs.push_back(ceil_div(sat_add(_w, J), T));
+                _total = sat_add(_total, sat_mul(_njobs[j], C));
+                _sum_wcet = sat_add(_sum_wcet, C);
+                _thresholds.push(j, threshold(j));
+            }
+
+            [[nodiscard]] int64_t at(int64_t w) {
+                if (w < _w) {
+                    rebuild(w);
+                }
+                _w = w;
+                while (!_thresholds.empty() && _thresholds.key(_thresholds.top()) < w) {
+                    size_t j = _thresholds.top();
+                    int64_t n = ceil_div(sat_add(w, _jitter[j]), _period[j]);
+                    _total = sat_add(_total, sat_mul(n - _njobs[j], _wcet[j]));
+                    _njobs[j] = n;
+                    _thresholds.update(j, threshold(j));
+                }
+                return _total;
+            }
+
+            [[nodiscard]] int64_t sum_wcet() const noexcept { return _sum_wcet; }
+
+        private:
+            std::vector<int64_t> _wcet, _period, _jitter, _njobs;
+            containers::IndexedHeap<int64_t> _thresholds;
+            int64_t _w{0}, _total{0}, _sum_wcet{0};
+
+            // Largest w for which task j still has _njobs[j] jobs in the window.
+            [[nodiscard]] int64_t threshold(size_t j) const noexcept {
+                return sat_mul(_njobs[j], _period[j]) - _jitter[j];
+            }
+
+            void rebuild(int64_t w) {
+                _total = 0;
+                for (size_t j = 0; j < _wcet.size(); j++) {
+                    _njobs[j] = ceil_div(sat_add(w, _jitter[j]), _period[j]);
+                    _total = sat_add(_total, sat_mul(_njobs[j], _wcet[j]));
+                    _thresholds.update(j, threshold(j));
+                }
+            }
+        };
+
+        int64_t term(const std::vector<time::TimeDuration> &v, size_t i, const char *what) {
+            if (v.empty()) return 0;
+            if (i >= v.size()) {
+                throw std::runtime_error(
+                    std::string("[analysis::response_time_analysis] Missing ") + what + " for task " +
+                    std::to_string(i));
+            }
+            return v[i].count();
+        }
+    }
+
+    RTAResult response_time_analysis(const std::vector<Task *> &tasks, const std::vector<size_t> &pri_idx,
+                                     const RTAParams &params) {
+        RTAResult result;
+        result.response_tm.assign(tasks.size(), time::ZERO_DURATION);
+        if (tasks.empty()) return result;
+        if (pri_idx.size() != tasks.size()) {
+            throw std::runtime_error("[analysis::response_time_analysis] Priority order must list every task");
+        }
+
+        Interference hp(tasks.size());
+        // Busy window (q = 0) and blocking of the previous task, for the warm start.
+        int64_t prev_w = 0, prev_B = 0;
+        bool have_prev = false;
+        for (size_t level = 0; level < pri_idx.size(); level++) {
+            size_t i = pri_idx[level];
+            auto *P = dynamic_cast<PeriodicTask *>(tasks.at(i));
+            if (P == nullptr || P->get_period() <= time::ZERO_DURATION) continue;
+            const int64_t C = P->get_wcet().count(), T = P->get_period().count(), D = P->get_rel_dl().count();
+            const int64_t J = term(params.release_jitter, i, "release jitter");
+            const int64_t B = term(params.blocking, i, "blocking");
+
+            int64_t R = 0, w_prev_q = 0;
+            bool missed = false;
+            for (int64_t q = 0; !missed; q++) {
+                // w_i(q) >= B + (q+1)C + sum C_j and w_i(q) >= w_i(q-1) + C. For q = 0 the previous task's
+                // window is a tighter bound: w_i >= w_{i-1} - B_{i-1} + B_i + C_i whenever B_i + C_i >= B_{i-1}.
+                int64_t w = sat_add(B, sat_add(sat_mul(q + 1, C), hp.sum_wcet()));
+                if (q == 0 && have_prev && B + C >= prev_B) {
+                    w = std::max(w, sat_add(prev_w - prev_B, B + C));
+                } else if (q > 0) {
+                    w = std::max(w, sat_add(w_prev_q, C));
+                }
+                while (true) {
+                    result.iterations++;
+                    int64_t next = sat_add(sat_add(B, sat_mul(q + 1, C)), hp.at(w));
+                    // R = w - qT + J; give up once it exceeds the deadline.
+                    if (sat_add(next, J) - q * T > D) {
+                        missed = true;
+                        break;
+                    }
+                    if (next == w) break;
+                    w = next;
+                }
+                if (missed) break;
+                if (q == 0) {
+                    prev_w = w;
+                    prev_B = B;
+                    have_prev = true;
+                }
+                w_prev_q = w;
+                R = std::max(R, w + J - q * T);
+                // The level-i busy period is over once the (q+1)-th job completes before the next release.
+                if (w + J <= (q + 1) * T) break;
+            }
+
+            if (missed) {
+                result.response_tm[i] = RTAResult::UNBOUNDED;
+                if (result.schedulable) {
+                    result.schedulable = false;
+                    result.first_miss = i;
+                }
+                if (params.stop_at_first_miss) {
+                    for (size_t k = level + 1; k < pri_idx.size(); k++) {
+                        if (dynamic_cast<PeriodicTask *>(tasks[pri_idx[k]]) != nullptr) {
+                            result.response_tm[pri_idx[k]] = RTAResult::UNBOUNDED;
+                        }
+                    }
+                    return result;
+                }
+                // Without a fixed point the warm start would not be a lower bound any more.
+                have_prev = false;
+            } else {
+                result.response_tm[i] = time::TimeDuration(R);
+            }
+            hp.add_task(C, T, J);
+        }
+        return result;
+    }
+}
@@ -0,0 +1,43 @@
+#include "rtss/clock.h"
+
+#include <algorithm>
+#include <array>
+
+namespace rtss::time {
+    namespace {
+        constexpr int CALIBRATION_SLEEPS = 20;
+        constexpr Clock::duration CALIBRATION_SLEEP = std::chrono::microseconds(100);
+        // Added to the measured overshoot for wake-ups slower than the calibration saw.
+        constexpr Clock::duration GUARD_MARGIN = std::chrono::microseconds(20);
+        constexpr Clock::duration MIN_GUARD = std::chrono::microseconds(20);
+        constexpr Clock::duration MAX_GUARD = std::chrono::milliseconds(2);
+
+        Clock::duration calibrate_spin_guard() {
+            std::array<Clock::duration, CALIBRATION_SLEEPS> overshoot{};
+            for (auto &o: overshoot) {
+                const TimePoint target = Clock::now() + CALIBRATION_SLEEP;
+                time::sleep_until(target);
+                o = Clock::now() - target;
+            }
+            // 90th percentile, so one preempted sample does not set the guard.
+            auto p90 = overshoot.begin() + CALIBRATION_SLEEPS * 9 / 10;
+            std::nth_element(overshoot.begin(), p90, overshoot.end());
+            return std::clamp(*p90 + GUARD_MARGIN, MIN_GUARD, MAX_GUARD);
+        }
+    }
+
+    Clock::duration spin_guard() {
+        static const Clock::duration guard = calibrate_spin_guard();
+        return guard;
+    }
+
+    void precise_sleep_until(TimePoint t) {
+        const TimePoint wake = t - spin_guard();
+        if (Clock::now() < wake) {
+            time::sleep_until(wake);
+        }
+        while (Clock::now() < t) {
+            cpu_relax();
+        }
+    }
+}
@@ -1,7 +1,5 @@
 #include "rtss/frame.h"
 
-#include <iostream>
-
 #include "rtss/task.h"
 
 namespace rtss {
@@ -9,7 +7,11 @@ namespace rtss {
         if (_jobs.empty()) {
             throw std::runtime_error("[Frame::run_frame] No jobs to run in this frame.");
         }
-        std::cout << "---- Frame ----" << std::endl;
+        // No clock to stamp the records with.
+        logging::EventLogger &logger = logging::EventLogger::global();
+        if (logger.enabled(logging::LogLevel::EVENTS)) {
+            logger.log({logging::LogRecord::NO_TIME, 0, 0, 0, logging::EventKind::FRAME_START});
+        }
         for (const auto &job: _jobs) {
             Task *T;
             if (job.task_id == static_cast<int16_t>(TaskID::IDLE)) {
@@ -17,8 +19,42 @@ namespace rtss {
             } else {
                 T = tasks_ref[job.task_id - 1]; // task_id starts from 1 so that 0 and -1 can be reserved.
             }
+            if (logger.enabled(logging::LogLevel::JOBS)) {
+                logger.log({logging::LogRecord::NO_TIME, time::to_ns(job.exec_tm), job.task_id, 0,
+                            logging::EventKind::DISPATCH});
+            }
             T->run_task(job.exec_tm);
-            std::cout << job.to_string() << std::endl;
+        }
+    }
+
+    void Frame::run_frame(const std::vector<Task *> &tasks_ref, time::SimClock &clock,
+                          logging::EventLogger *logger,
+                          const std::vector<schedulers::SchedulerObserver *> &observers) const {
+        if (_jobs.empty()) {
+            throw std::runtime_error("[Frame::run_frame] No jobs to run in this frame.");
+        }
+        if (logger != nullptr && logger->enabled(logging::LogLevel::EVENTS)) {
+            logger->log({time::to_ns(clock.now()), 0, 0, 0, logging::EventKind::FRAME_START});
+        }
+        for (const auto &job: _jobs) {
+            Task *T;
+            if (job.task_id == static_cast<int16_t>(TaskID::IDLE)) {
+                T = Task::Idle();
+            } else {
+                T = tasks_ref[job.task_id - 1]; // task_id starts from 1 so that 0 and -1 can be reserved.
+            }
+            if (logger != nullptr && logger->enabled(logging::LogLevel::JOBS)) {
+                logger->log({time::to_ns(clock.now()), time::to_ns(job.exec_tm), job.task_id, 0,
+                             logging::EventKind::DISPATCH});
+            }
+            if (!observers.empty()) {
+                const time::TimeDuration now = clock.now();
+                const size_t idx = job.task_id == static_cast<int16_t>(TaskID::IDLE)
+                                       ? schedulers::IDLE_TASK
+                                       : static_cast<size_t>(job.task_id - 1);
+                for (auto *o: observers) o->on_dispatch(now, idx, 0);
+            }
+            T->run_task(job.exec_tm, clock);
         }
     }
 }
@@ -0,0 +1,148 @@
+#include "rtss/generators/taskset_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "rtss/generators/utilisation.h"
+
+namespace rtss::generators {
+    namespace {
+        constexpr int64_t TICKS_PER_MS = time::createTimeDurationMs(1).count();
+
+        time::TimeDuration ms(int64_t v) { return time::TimeDuration(v * TICKS_PER_MS); }
+    }
+
+    void TaskSetGenerator::check(const GeneratorParams &params) const {
+        if (params.period_min_ms <= 0 || params.period_max_ms < params.period_min_ms) {
+            throw std::runtime_error("[TaskSetGenerator::generate] Invalid period range");
+        }
+        if (params.period_max_ms > std::numeric_limits<int64_t>::max() / TICKS_PER_MS) {
+            throw std::runtime_error("[TaskSetGenerator::generate] Period range exceeds time::TimeDuration");
+        }
+        if (params.period_granularity_ms <= 0) {
+            throw std::runtime_error("[TaskSetGenerator::generate] Period granularity must be positive");
+        }
+        if (params.utilisation < 0) {
+            throw std::runtime_error("[TaskSetGenerator::generate] Utilisation cannot be negative");
+        }
+        if (params.dl_ratio_min < 0 || params.dl_ratio_max < params.dl_ratio_min) {
+            throw std::runtime_error("[TaskSetGenerator::generate] Invalid deadline ratio range");
+        }
+        if (params.naperiodic > 0 && (params.aperiodic_arrival_max_ms <= 0 || params.aperiodic_wcet_min_ms < 0 ||
+                                      params.aperiodic_wcet_max_ms < params.aperiodic_wcet_min_ms)) {
+            throw std::runtime_error("[TaskSetGenerator::generate] Invalid aperiodic task parameters");
+        }
+    }
+
+    int64_t TaskSetGenerator::draw_period_ms(const GeneratorParams &params) {
+        switch (params.periods) {
+            case PeriodDistribution::LOG_UNIFORM: {
+                // Draw over [min, max + granularity) so that max itself can come out of the rounding.
+                double lo = std::log(static_cast<double>(params.period_min_ms));
+                double hi = std::log(static_cast<double>(params.period_max_ms + params.period_granularity_ms));
+                auto p = static_cast<int64_t>(std::exp(_rng.uniform(lo, hi)));
+                p -= p % params.period_granularity_ms;
+                return std::clamp(p, params.period_min_ms, params.period_max_ms);
+            }
+            case PeriodDistribution::HARMONIC: {
+                int64_t nsteps = 0;
+                while ((params.period_min_ms << (nsteps + 1)) <= params.period_max_ms) nsteps++;
+                return params.period_min_ms << _rng.below(nsteps + 1);
+            }
+            case PeriodDistribution::BOUNDED_HYPERPERIOD:
+                return _divisors[_rng.below(_divisors.size())];
+            default:
+                throw std::runtime_error("[TaskSetGenerator::generate] Invalid PeriodDistribution");
+        }
+    }
+
+    void TaskSetGenerator::generate(const GeneratorParams &params, TaskSet &out) {
+        check(params);
+        const size_t n = params.nperiodic;
+        switch (params.method) {
+            case UtilisationMethod::UUNIFAST:
+                uunifast(_rng, n, params.utilisation, _utilisation);
+                break;
+            case UtilisationMethod::UUNIFAST_DISCARD:
+                uunifast_discard(_rng, n, params.utilisation, _utilisation);
+                break;
+            case UtilisationMethod::RANDFIXEDSUM:
+                randfixedsum(_rng, n, params.utilisation, _utilisation, _rfs_table);
+                break;
+            default:
+                throw std::runtime_error("[TaskSetGenerator::generate] Invalid UtilisationMethod");
+        }
+        if (params.periods == PeriodDistribution::BOUNDED_HYPERPERIOD) {
+            const int64_t key[3] = {params.hyperperiod_bound_ms, params.period_min_ms, params.period_max_ms};
+            if (!std::equal(key, key + 3, _divisors_key)) {
+                if (params.hyperperiod_bound_ms <= 0) {
+                    throw std::runtime_error("[TaskSetGenerator::generate] Hyperperiod bound must be positive");
+                }
+                _divisors.clear();
+                for (int64_t d = 1; d * d <= params.hyperperiod_bound_ms; d++) {
+                    if (params.hyperperiod_bound_ms % d != 0) continue;
+                    for (int64_t v: {d, params.hyperperiod_bound_ms / d}) {
+                        if (v >= params.period_min_ms && v <= params.period_max_ms &&
+                            (_divisors.empty() || _divisors.back() != v)) {
+                            _divisors.push_back(v);
+                        }
+                    }
+                }
+                std::sort(_divisors.begin(), _divisors.end());
+                std::copy(key, key + 3, _divisors_key);
+            }
+            if (_divisors.empty()) {
+                throw std::runtime_error(
+                    "[TaskSetGenerator::generate] No divisor of the hyperperiod bound lies in the period range");
+            }
+        }
+
+        out.clear();
+        out.reserve(n + params.naperiodic);
+        for (size_t i = 0; i < n; i++) {
+            const int64_t period_ms = draw_period_ms(params);
+            const time::TimeDuration T = ms(period_ms);
+            auto C = time::TimeDuration(std::max<int64_t>(
+                1, std::llround(_utilisation[i] * static_cast<double>(T.count()))));
+            double r = _rng.uniform(params.dl_ratio_min, params.dl_ratio_max);
+            auto D = C + time::TimeDuration(std::llround(r * static_cast<double>((T - C).count())));
+            time::TimeDuration phase = params.random_phases ? ms(static_cast<int64_t>(_rng.below(period_ms)))
+                                                            : time::ZERO_DURATION;
+            out.add_periodic(phase, T, C, D, i + 1 <= UINT16_MAX ? static_cast<uint16_t>(i + 1) : 0);
+        }
+        for (size_t i = 0; i < params.naperiodic; i++) {
+            time::TimeDuration arrival = ms(static_cast<int64_t>(_rng.below(params.aperiodic_arrival_max_ms)));
+            int64_t span = params.aperiodic_wcet_max_ms - params.aperiodic_wcet_min_ms + 1;
+            time::TimeDuration C = ms(params.aperiodic_wcet_min_ms + static_cast<int64_t>(_rng.below(span)));
+            size_t id = n + i + 1;
+            out.add_aperiodic(arrival, C, id <= UINT16_MAX ? static_cast<uint16_t>(id) : 0);
+        }
+    }
+
+    void make_tasks(const TaskSet &task_set, TaskStorage &storage) {
+        storage.periodic.clear();
+        storage.aperiodic.clear();
+        storage.tasks.clear();
+        size_t nperiodic = 0;
+        for (size_t i = 0; i < task_set.size(); i++) {
+            if (task_set.is_periodic(i)) nperiodic++;
+        }
+        // Reserved up front, so the pointers taken below stay valid.
+        storage.periodic.reserve(nperiodic);
+        storage.aperiodic.reserve(task_set.size() - nperiodic);
+        storage.tasks.reserve(task_set.size());
+        for (size_t i = 0; i < task_set.size(); i++) {
+            Task *T;
+            if (task_set.is_periodic(i)) {
+                T = &storage.periodic.emplace_back(task_set.phase(i), task_set.period(i), task_set.wcet(i),
+                                                   task_set.rel_dl(i));
+            } else {
+                T = &storage.aperiodic.emplace_back(task_set.phase(i), task_set.wcet(i));
+            }
+            if (task_set.id(i) != 0) T->set_id(task_set.id(i));
+            storage.tasks.push_back(T);
+        }
+    }
+}
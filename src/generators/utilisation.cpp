@@ -0,0 +1,103 @@
+#include "rtss/generators/utilisation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace rtss::generators {
+    void uunifast(Rng &rng, size_t n, double total, std::vector<double> &out) {
+        if (total < 0) {
+            throw std::runtime_error("[generators::uunifast] Total utilisation cannot be negative");
+        }
+        out.resize(n);
+        if (n == 0) return;
+        double sum = total;
+        for (size_t i = 1; i < n; i++) {
+            double next = sum * std::pow(rng.uniform(), 1.0 / static_cast<double>(n - i));
+            out[i - 1] = sum - next;
+            sum = next;
+        }
+        out[n - 1] = sum;
+    }
+
+    void uunifast_discard(Rng &rng, size_t n, double total, std::vector<double> &out, size_t max_attempts) {
+        if (total > static_cast<double>(n)) {
+            throw std::runtime_error("[generators::uunifast_discard] Total utilisation exceeds the number of tasks");
+        }
+        for (size_t attempt = 0; attempt < max_attempts; attempt++) {
+            uunifast(rng, n, total, out);
+            if (std::all_of(out.begin(), out.end(), [](double u) { return u <= 1.0; })) {
+                return;
+            }
+        }
+        throw std::runtime_error("[generators::uunifast_discard] No valid utilisation vector within the attempt limit");
+    }
+
+    void randfixedsum(Rng &rng, size_t n, double total, std::vector<double> &out, std::vector<double> &table) {
+        if (total < 0 || total > static_cast<double>(n)) {
+            throw std::runtime_error("[generators::randfixedsum] Total utilisation must be within [0, n]");
+        }
+        out.resize(n);
+        if (n == 0) return;
+        if (n == 1) {
+            out[0] = total;
+            return;
+        }
+        const double tiny = std::numeric_limits<double>::denorm_min();
+        const auto nd = static_cast<double>(n);
+        const size_t k = std::min(static_cast<size_t>(std::floor(total)), n - 1);
+        const auto kd = static_cast<double>(k);
+        const double s = std::clamp(total, kd, kd + 1);
+        // s1[j] = s - k + j, s2[j] = k + n - j - s, for j in [0, n).
+        auto s1 = [&](size_t j) { return s - kd + static_cast<double>(j); };
+        auto s2 = [&](size_t j) { return kd + nd - static_cast<double>(j) - s; };
+
+        // The draw starts in column k + 1 of the transition table and only ever moves left,
+        // so columns beyond k + 1 (and w columns beyond k + 2) are never needed.
+        // Rows of w are rescaled as they go, which leaves the ratios in t unchanged and
+        // keeps long task lists from underflowing.
+        const size_t ncols = k + 1;
+        table.assign((n - 1) * ncols + 2 * (ncols + 1), 0.0);
+        double *t = table.data(); // t(i, c) at t[(i - 1) * ncols + (c - 1)], i in [1, n), c in [1, i]
+        double *w_prev = t + (n - 1) * ncols; // w(i, c) at w[c - 1], c in [1, k + 2]
+        double *w_cur = w_prev + ncols + 1;
+        w_prev[1] = 1.0;
+        for (size_t i = 2; i <= n; i++) {
+            std::fill(w_cur, w_cur + ncols + 1, 0.0);
+            double row_max = 0.0;
+            const size_t cmax = std::min(i, ncols);
+            for (size_t c = 1; c <= cmax; c++) {
+                double tmp1 = w_prev[c] * s1(c - 1) / static_cast<double>(i);
+                double tmp2 = w_prev[c - 1] * s2(n - i + c - 1) / static_cast<double>(i);
+                w_cur[c] = tmp1 + tmp2;
+                double tmp3 = w_cur[c] + tiny;
+                t[(i - 2) * ncols + (c - 1)] = s2(n - i + c - 1) > s1(c - 1) ? tmp2 / tmp3 : 1.0 - tmp1 / tmp3;
+                row_max = std::max(row_max, w_cur[c]);
+            }
+            if (row_max > 0) {
+                for (size_t c = 0; c <= ncols; c++) w_cur[c] /= row_max;
+            }
+            std::swap(w_prev, w_cur);
+        }
+
+        double rem = s, sm = 0.0, pr = 1.0;
+        size_t j = k + 1;
+        for (size_t i = n - 1; i >= 1; i--) {
+            bool e = rng.uniform() <= t[(i - 1) * ncols + (std::max<size_t>(j, 1) - 1)];
+            double sx = std::pow(rng.uniform(), 1.0 / static_cast<double>(i));
+            sm += (1.0 - sx) * pr * rem / static_cast<double>(i + 1);
+            pr *= sx;
+            out[n - i - 1] = sm + (e ? pr : 0.0);
+            if (e) {
+                rem -= 1.0;
+                j--;
+            }
+        }
+        out[n - 1] = sm + pr * rem;
+        for (size_t i = n - 1; i > 0; i--) {
+            std::swap(out[i], out[rng.below(i + 1)]);
+        }
+    }
+}
@@ -0,0 +1,364 @@
+#include "rtss/io/binary.h"
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "rtss/io/mapped_file.h"
+#include "task_sinks.h"
+
+namespace rtss::io {
+    // Fixed-width tables are TaskScheduleEntry arrays on disk, so the in-memory layout is the file format.
+    static_assert(std::is_trivially_copyable_v<TaskScheduleEntry> && std::is_standard_layout_v<TaskScheduleEntry>);
+    static_assert(sizeof(TaskScheduleEntry) == 16 && offsetof(TaskScheduleEntry, task_id) == 8,
+                  "TaskScheduleEntry layout is part of the binary table format");
+    // Times are stored as 64-bit tick counts with the tick, in ns, in the header.
+    static_assert(sizeof(time::TimeDuration::rep) == 8, "Binary files store 64-bit times");
+    constexpr uint64_t TICK_NS = static_cast<uint64_t>(time::TICK_NS);
+
+    namespace {
+        BinaryHeader make_header(BinaryKind kind, uint16_t flags, uint16_t record_size, uint64_t count,
+                                 uint64_t time_unit_ns) {
+            BinaryHeader h{};
+            std::memcpy(h.magic, BINARY_MAGIC, sizeof(h.magic));
+            h.byte_order = BINARY_BYTE_ORDER_TAG;
+            h.version = BINARY_VERSION;
+            h.kind = static_cast<uint16_t>(kind);
+            h.flags = flags;
+            h.record_size = record_size;
+            h.count = count;
+            h.time_unit_ns = time_unit_ns;
+            return h;
+        }
+
+        // Checks the header and returns it; the records follow it in `file`.
+        BinaryHeader read_header(const MappedFile &file, BinaryKind kind, const char *fn) {
+            BinaryHeader h{};
+            if (file.size() < sizeof(h)) {
+                throw std::runtime_error(std::string(fn) + " File is too short for a header");
+            }
+            std::memcpy(&h, file.data(), sizeof(h));
+            if (std::memcmp(h.magic, BINARY_MAGIC, sizeof(h.magic)) != 0) {
+                throw std::runtime_error(std::string(fn) + " Not an rtss binary file");
+            }
+            if (h.byte_order != BINARY_BYTE_ORDER_TAG) {
+                throw std::runtime_error(std::string(fn) + " File was written with a different byte order");
+            }
+            if (h.version == 0 || h.version > BINARY_VERSION) {
+                throw std::runtime_error(std::string(fn) + " Unsupported format version " + std::to_string(h.version));
+            }
+            if (h.kind != static_cast<uint16_t>(kind)) {
+                throw std::runtime_error(std::string(fn) + " Unexpected record kind " + std::to_string(h.kind));
+            }
+            if (h.time_unit_ns == 0) {
+                throw std::runtime_error(std::string(fn) + " Time unit is zero");
+            }
+            if (h.record_size != 0) {
+                size_t payload = file.size() - sizeof(h);
+                if (h.count > payload / h.record_size || h.count * h.record_size != payload) {
+                    throw std::runtime_error(std::string(fn) + " File size does not match the record count");
+                }
+            }
+            return h;
+        }
+
+        std::ofstream open_for_writing(const std::filesystem::path &path, const char *fn) {
+            std::ofstream ofs(path, std::ios::binary);
+            if (!ofs) {
+                throw std::runtime_error(std::string(fn) + " Failed to open file for writing: " + path.string());
+            }
+            return ofs;
+        }
+
+        void finish_writing(std::ofstream &ofs, const std::filesystem::path &path, const char *fn) {
+            ofs.flush();
+            if (!ofs) {
+                throw std::runtime_error(std::string(fn) + " Failed to write " + path.string());
+            }
+        }
+
+        // LEB128: 7 bits per byte, high bit set on all but the last byte.
+        char *put_varint(char *p, uint64_t v) noexcept {
+            while (v >= 0x80) {
+                *p++ = static_cast<char>(v | 0x80);
+                v >>= 7;
+            }
+            *p++ = static_cast<char>(v);
+            return p;
+        }
+
+        const char *get_varint(const char *p, const char *end, uint64_t &v) noexcept {
+            v = 0;
+            for (unsigned shift = 0; p < end && shift < 64; shift += 7) {
+                auto byte = static_cast<uint8_t>(*p++);
+                v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0) return p;
+            }
+            return nullptr;
+        }
+
+        // Largest number of ticks all start times are a multiple of, so that deltas take as few bytes as possible:
+        // tables built from millisecond CSVs encode most deltas in one or two bytes.
+        uint64_t common_time_unit(const std::vector<TaskScheduleEntry> &entries) {
+            uint64_t unit = 0;
+            for (const auto &se: entries) {
+                unit = std::gcd(unit, static_cast<uint64_t>(se.start_time.count()));
+                if (unit == 1) break;
+            }
+            return unit == 0 ? 1 : unit;
+        }
+
+        // Ticks per stored unit; the unit must be a whole number of ticks of this build.
+        int64_t ticks_per_unit(const BinaryHeader &h, const char *fn) {
+            if (h.time_unit_ns % TICK_NS != 0 || h.time_unit_ns / TICK_NS > INT64_MAX) {
+                throw std::runtime_error(std::string(fn) + " Time unit of " + std::to_string(h.time_unit_ns) +
+                                         "ns is not a whole number of ticks");
+            }
+            return static_cast<int64_t>(h.time_unit_ns / TICK_NS);
+        }
+
+        // Fixed-width records are used as they are, so they must hold ticks of this build.
+        void check_fixed_table(const BinaryHeader &h, const char *fn) {
+            if (h.record_size != sizeof(TaskScheduleEntry)) {
+                throw std::runtime_error(std::string(fn) + " Unexpected record size " + std::to_string(h.record_size));
+            }
+            if (h.time_unit_ns != TICK_NS) {
+                throw std::runtime_error(std::string(fn) + " Times are in units of " + std::to_string(h.time_unit_ns) +
+                                         "ns, this build's tick is " + std::to_string(TICK_NS) + "ns");
+            }
+        }
+
+        void decode_delta_table(const MappedFile &file, const BinaryHeader &h, std::vector<TaskScheduleEntry> &out) {
+            constexpr const char *FN = "[io::read_task_table_binary]";
+            const char *p = file.data() + sizeof(BinaryHeader);
+            const char *const end = file.data() + file.size();
+            // Every record takes at least 3 bytes.
+            if (h.count > static_cast<uint64_t>(end - p) / 3) {
+                throw std::runtime_error(std::string(FN) + " File size does not match the record count");
+            }
+            const auto unit = static_cast<uint64_t>(ticks_per_unit(h, FN));
+            out.reserve(h.count);
+            uint64_t t = 0;
+            for (uint64_t i = 0; i < h.count; i++) {
+                uint64_t delta;
+                p = get_varint(p, end, delta);
+                if (p == nullptr || end - p < 2) {
+                    throw std::runtime_error(std::string(FN) + " Truncated record " + std::to_string(i));
+                }
+                int16_t id;
+                std::memcpy(&id, p, sizeof(id));
+                p += sizeof(id);
+                t += delta;
+                out.emplace_back(time::TimeDuration(static_cast<int64_t>(t * unit)), id);
+            }
+            if (p != end) {
+                throw std::runtime_error(std::string(FN) + " Trailing bytes after the last record");
+            }
+        }
+    }
+
+    void write_task_list_binary(const std::vector<Task *> &tasks, const std::filesystem::path &bin_path) {
+        constexpr const char *FN = "[io::write_task_list_binary]";
+        std::vector<BinaryTaskRecord> records(tasks.size());
+        for (size_t i = 0; i < tasks.size(); i++) {
+            BinaryTaskRecord &r = records[i];
+            r.id = tasks[i]->get_id();
+            r.phase = tasks[i]->get_phase().count();
+            r.wcet = tasks[i]->get_wcet().count();
+            if (const auto *P = dynamic_cast<const PeriodicTask *>(tasks[i])) {
+                r.type = 'P';
+                r.period = P->get_period().count();
+                r.rel_dl = P->get_rel_dl().count();
+            } else if (dynamic_cast<const AperiodicTask *>(tasks[i]) != nullptr) {
+                r.type = 'A';
+            } else {
+                throw std::runtime_error(std::string(FN) + " Only periodic and aperiodic tasks can be written");
+            }
+        }
+        std::ofstream ofs = open_for_writing(bin_path, FN);
+        BinaryHeader h = make_header(BinaryKind::TASK_LIST, 0, sizeof(BinaryTaskRecord), records.size(), TICK_NS);
+        ofs.write(reinterpret_cast<const char *>(&h), sizeof(h));
+        ofs.write(reinterpret_cast<const char *>(records.data()),
+                  static_cast<std::streamsize>(records.size() * sizeof(BinaryTaskRecord)));
+        finish_writing(ofs, bin_path, FN);
+    }
+
+    namespace {
+        // Creates the tasks of a task list file in record order with `sink`, as
+        // parse_task_list() in input.cpp does for CSV files.
+        template<typename Sink>
+        void parse_task_records(const std::string &file_path, Metadata &meta, const char *fn, Sink &sink) {
+            MappedFile file(file_path);
+            BinaryHeader h = read_header(file, BinaryKind::TASK_LIST, fn);
+            if (h.record_size != sizeof(BinaryTaskRecord)) {
+                throw std::runtime_error(std::string(fn) + " Unexpected record size " + std::to_string(h.record_size));
+            }
+            const int64_t unit = ticks_per_unit(h, fn);
+            meta.fully_periodic = true;
+            sink.reserve(h.count);
+            const char *p = file.data() + sizeof(h);
+            for (uint64_t i = 0; i < h.count; i++, p += sizeof(BinaryTaskRecord)) {
+                BinaryTaskRecord r{};
+                std::memcpy(&r, p, sizeof(r));
+                auto ns = [unit](int64_t v) { return time::TimeDuration(v * unit); };
+                Task *T;
+                switch (r.type) {
+                    case 'P':
+                        T = &sink.add_periodic(ns(r.phase), ns(r.period), ns(r.wcet), ns(r.rel_dl));
+                        break;
+                    case 'A':
+                        T = &sink.add_aperiodic(ns(r.phase), ns(r.wcet));
+                        meta.fully_periodic = false;
+                        break;
+                    default:
+                        throw std::runtime_error(std::string(fn) + " Invalid task type in record " + std::to_string(i));
+                }
+                T->set_id(r.id);
+            }
+        }
+    }
+
+    void read_task_list_binary(std::vector<Task *> &tasks, const std::string &file_path, Metadata &meta) {
+        constexpr const char *FN = "[io::read_task_list_binary]";
+        if (!tasks.empty()) {
+            throw std::runtime_error(std::string(FN) + " std::vector<Task> passed has to be empty");
+        }
+        NewTasks sink{tasks};
+        try {
+            parse_task_records(file_path, meta, FN, sink);
+        } catch (...) {
+            sink.discard();
+            throw;
+        }
+    }
+
+    void read_task_list_binary(TaskStore &store, const std::string &file_path, Metadata &meta) {
+        constexpr const char *FN = "[io::read_task_list_binary]";
+        if (!store.empty()) {
+            throw std::runtime_error(std::string(FN) + " TaskStore passed has to be empty");
+        }
+        try {
+            parse_task_records(file_path, meta, FN, store);
+        } catch (...) {
+            store.release();
+            throw;
+        }
+    }
+
+    void write_task_table_binary(const TaskTableBuilder &tbl_builder, const std::filesystem::path &bin_path,
+                                 bool delta_times) {
+        constexpr const char *FN = "[io::write_task_table_binary]";
+        const std::vector<TaskScheduleEntry> &entries = tbl_builder.entries();
+        std::ofstream ofs = open_for_writing(bin_path, FN);
+        constexpr size_t BLOCK_SZ = 1 << 16;
+        if (!delta_times) {
+            BinaryHeader h = make_header(BinaryKind::TASK_TABLE, 0, sizeof(TaskScheduleEntry), entries.size(), TICK_NS);
+            ofs.write(reinterpret_cast<const char *>(&h), sizeof(h));
+            // Records are copied field by field into a zeroed block, so the padding bytes
+            // are zero and the same table always gives the same file.
+            std::string buf(BLOCK_SZ, '\0');
+            size_t len = 0;
+            for (const auto &se: entries) {
+                int64_t t = se.start_time.count();
+                std::memcpy(buf.data() + len, &t, sizeof(t));
+                std::memcpy(buf.data() + len + offsetof(TaskScheduleEntry, task_id), &se.task_id, sizeof(se.task_id));
+                len += sizeof(TaskScheduleEntry);
+                if (len == BLOCK_SZ) {
+                    ofs.write(buf.data(), static_cast<std::streamsize>(len));
+                    len = 0;
+                }
+            }
+            ofs.write(buf.data(), static_cast<std::streamsize>(len));
+            finish_writing(ofs, bin_path, FN);
+            return;
+        }
+
+        const uint64_t unit = common_time_unit(entries);
+        BinaryHeader h = make_header(BinaryKind::TASK_TABLE, DELTA_TIMES, 0, entries.size(), unit * TICK_NS);
+        ofs.write(reinterpret_cast<const char *>(&h), sizeof(h));
+        constexpr size_t MAX_RECORD_SZ = 10 + sizeof(int16_t);
+        std::string buf(BLOCK_SZ + MAX_RECORD_SZ, '\0');
+        size_t len = 0;
+        int64_t prev = 0;
+        for (const auto &se: entries) {
+            if (se.start_time.count() < prev) {
+                throw std::runtime_error(std::string(FN) + " Start times must not decrease for delta encoding");
+            }
+            char *p = put_varint(buf.data() + len, static_cast<uint64_t>(se.start_time.count() - prev) / unit);
+            std::memcpy(p, &se.task_id, sizeof(se.task_id));
+            len = p + sizeof(se.task_id) - buf.data();
+            prev = se.start_time.count();
+            if (len >= BLOCK_SZ) {
+                ofs.write(buf.data(), static_cast<std::streamsize>(len));
+                len = 0;
+            }
+        }
+        ofs.write(buf.data(), static_cast<std::streamsize>(len));
+        finish_writing(ofs, bin_path, FN);
+    }
+
+    void read_task_table_binary(TaskTableBuilder &tbl_builder, const std::string &file_path) {
+        constexpr const char *FN = "[io::read_task_table_binary]";
+        if (tbl_builder.size() != 0) {
+            throw std::runtime_error(std::string(FN) + " Passed non-empty task table builder to parser");
+        }
+        MappedFile file(file_path);
+        BinaryHeader h = read_header(file, BinaryKind::TASK_TABLE, FN);
+        std::vector<TaskScheduleEntry> entries;
+        if (h.flags & DELTA_TIMES) {
+            decode_delta_table(file, h, entries);
+        } else {
+            check_fixed_table(h, FN);
+            entries.resize(h.count);
+            std::memcpy(entries.data(), file.data() + sizeof(h), h.count * sizeof(TaskScheduleEntry));
+        }
+        tbl_builder.append(std::move(entries));
+    }
+
+    TaskTable load_task_table_binary(const std::string &file_path) {
+        constexpr const char *FN = "[io::load_task_table_binary]";
+        auto file = std::make_shared<MappedFile>(file_path);
+        BinaryHeader h = read_header(*file, BinaryKind::TASK_TABLE, FN);
+        if (h.flags & DELTA_TIMES) {
+            std::vector<TaskScheduleEntry> entries;
+            decode_delta_table(*file, h, entries);
+            return TaskTable(std::move(entries));
+        }
+        check_fixed_table(h, FN);
+        // The header is 40 bytes and mappings are page aligned, so the records are suitably aligned.
+        const auto *entries = reinterpret_cast<const TaskScheduleEntry *>(file->data() + sizeof(h));
+        return TaskTable(entries, h.count, std::move(file));
+    }
+
+    void convert_task_list_csv_to_binary(const std::string &csv_path, const std::filesystem::path &bin_path) {
+        TaskStore store;
+        Metadata meta;
+        read_task_list_from_csv(store, csv_path, meta);
+        write_task_list_binary(store.tasks(), bin_path);
+    }
+
+    void convert_task_list_binary_to_csv(const std::string &bin_path, const std::filesystem::path &csv_path) {
+        TaskStore store;
+        Metadata meta;
+        read_task_list_binary(store, bin_path, meta);
+        write_task_list_csv(store.tasks(), csv_path);
+    }
+
+    void convert_task_table_csv_to_binary(const std::string &csv_path, const std::filesystem::path &bin_path,
+                                          bool delta_times) {
+        TaskTableBuilder builder;
+        read_task_table_from_csv(builder, csv_path, 0);
+        write_task_table_binary(builder, bin_path, delta_times);
+    }
+
+    void convert_task_table_binary_to_csv(const std::string &bin_path, const std::filesystem::path &csv_path) {
+        TaskTableBuilder builder;
+        read_task_table_binary(builder, bin_path);
+        write_task_table_csv(builder, csv_path);
+    }
+}
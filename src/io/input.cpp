@@ -1,64 +1,287 @@
 #include "rtss/io/input.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <vector>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 
+#include "rtss/io/mapped_file.h"
+#include "rtss/parallel/thread_pool.h"
 #include "rtss/task.h"
 #include "rtss/tasktable.h"
 #include "rtss/time.h"
+#include "task_sinks.h"
 
 namespace rtss::io {
-    std::ifstream _init_ifs_for_csv(const std::string &file_path, const std::string &header) {
-        std::ifstream ifs(file_path);
-        if (!ifs) {
-            throw std::runtime_error("[io::_init_ifs_for_csv] Failed to open " + file_path);
+    namespace {
+        // A mapped CSV file whose header has been checked; `body` starts at line 2.
+        struct CsvFile {
+            MappedFile file;
+            std::string_view body;
+        };
+
+        // Drops a trailing '\r', so files with CRLF line ends parse too.
+        std::string_view chomp(std::string_view line) noexcept {
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            return line;
         }
-        std::string line;
-        std::getline(ifs, line);
-        if (line != header) {
-            throw std::runtime_error("[io::_init_ifs_for_csv] Invalid CSV header: " + line);
+
+        CsvFile _map_csv(const std::string &file_path, std::string_view header, const char *fn) {
+            CsvFile csv{MappedFile(file_path), {}};
+            std::string_view data = csv.file.view();
+            const char *nl = static_cast<const char *>(std::memchr(data.data(), '\n', data.size()));
+            size_t header_len = nl != nullptr ? static_cast<size_t>(nl - data.data()) : data.size();
+            std::string_view line = chomp(data.substr(0, header_len));
+            if (line != header) {
+                throw std::runtime_error(std::string(fn) + " Invalid CSV header: " + std::string(line));
+            }
+            csv.body = data.substr(std::min(data.size(), header_len + 1));
+            return csv;
         }
-        return ifs;
-    }
 
-    void read_task_list_from_csv(std::vector<Task *> &tasks, const std::string &file_path, Metadata &meta) {
-        if (!tasks.empty()) {
-            throw std::runtime_error("[io::read_task_list_from_csv] std::vector<Task> passed has to be empty");
+        // Calls f(line, line_no) for every line of `body` that is neither empty nor a '#' comment.
+        // Lines are found with memchr, which scans a word or a vector register at a time.
+        template<typename F>
+        void for_each_line(std::string_view body, size_t first_line_no, F &&f) {
+            const char *p = body.data();
+            const char *const end = p + body.size();
+            size_t line_no = first_line_no;
+            while (p < end) {
+                const char *nl = static_cast<const char *>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+                const char *line_end = nl != nullptr ? nl : end;
+                std::string_view line = chomp(std::string_view(p, static_cast<size_t>(line_end - p)));
+                if (!line.empty() && line[0] != '#') {
+                    f(line, line_no);
+                }
+                line_no++;
+                p = line_end + 1;
+            }
         }
-        std::ifstream ifs = _init_ifs_for_csv(file_path, "type,phase,period,wcet,rel_dl");
-        std::string line;
-        meta.fully_periodic = true;
-        Task *T; // Temporary pointer for task creation.
-        short id_counter = 1;
-        while (std::getline(ifs, line)) {
-            if (line.empty() || line[0] == '#')
-                continue;
-            std::istringstream iss(line);
-            char act_type, comma;
-            int phase, period, wcet, rel_dl;
-            if (!(iss >> act_type >> comma >> phase >> comma >> period >> comma >> wcet >> comma >> rel_dl)) {
-                throw std::runtime_error("[io::read_task_list_from_csv] Invalid CSV line: " + line);
-            }
-            switch (act_type) {
-                case 'P':
-                    T = new PeriodicTask(time::createTimeDurationMs(phase), time::createTimeDurationMs(period),
-                                         time::createTimeDurationMs(wcet), time::createTimeDurationMs(rel_dl));
+
+        // Field-by-field reader for one line. Blanks around the fields are skipped, like operator>> did.
+        class FieldReader {
+        public:
+            explicit FieldReader(std::string_view line) : _p(line.data()), _end(line.data() + line.size()) {
+            }
+
+            bool read_int(int64_t &v) {
+                skip_blanks();
+                auto [ptr, ec] = std::from_chars(_p, _end, v);
+                if (ec != std::errc{}) return false;
+                _p = ptr;
+                skip_blanks();
+                return true;
+            }
+
+            // A time with an optional unit suffix; see time::parse_duration().
+            bool read_duration(time::TimeDuration &d) {
+                skip_blanks();
+                const char *tok = _p;
+                while (_p != _end && *_p != ',' && *_p != ' ' && *_p != '\t') _p++;
+                if (!time::parse_duration(std::string_view(tok, static_cast<size_t>(_p - tok)), d)) return false;
+                skip_blanks();
+                return true;
+            }
+
+            bool read_char(char &c) {
+                skip_blanks();
+                if (_p == _end) return false;
+                c = *_p++;
+                skip_blanks();
+                return true;
+            }
+
+            bool expect(char c) {
+                if (_p == _end || *_p != c) return false;
+                _p++;
+                return true;
+            }
+
+            [[nodiscard]] bool at_end() const noexcept { return _p == _end; }
+
+        private:
+            const char *_p;
+            const char *const _end;
+
+            void skip_blanks() noexcept {
+                while (_p != _end && (*_p == ' ' || *_p == '\t')) _p++;
+            }
+        };
+
+        [[noreturn]] void invalid_line(const char *fn, size_t line_no, std::string_view line) {
+            throw std::runtime_error(std::string(fn) + " Invalid CSV line " + std::to_string(line_no) + ": " +
+                                     std::string(line));
+        }
+
+        // Writes `d` as time::put_duration() does, but whole milliseconds as a bare number.
+        char *put_csv_duration(char *p, char *end, time::TimeDuration d) {
+            if (d % time::createTimeDurationMs(1) == time::ZERO_DURATION) {
+                return std::to_chars(p, end, time::toInt(d)).ptr;
+            }
+            return time::put_duration(p, end, d);
+        }
+
+        // Parses the task list and creates the tasks in file order with `sink`, which provides
+        // reserve(n) (n is an upper bound on the task count) and add_periodic()/add_aperiodic()
+        // as TaskStore does.
+        template<typename Sink>
+        void parse_task_list(const std::string &file_path, Metadata &meta, const char *fn, Sink &sink) {
+            CsvFile csv = _map_csv(file_path, "type,phase,period,wcet,rel_dl", fn);
+            meta.fully_periodic = true;
+            sink.reserve(static_cast<size_t>(std::count(csv.body.begin(), csv.body.end(), '\n')) + 1);
+            short id_counter = 1;
+            for_each_line(csv.body, 2, [&](std::string_view line, size_t line_no) {
+                FieldReader r(line);
+                char act_type;
+                time::TimeDuration phase, period, wcet, rel_dl;
+                if (!(r.read_char(act_type) && r.expect(',') && r.read_duration(phase) && r.expect(',') &&
+                      r.read_duration(period) && r.expect(',') && r.read_duration(wcet) && r.expect(',') &&
+                      r.read_duration(rel_dl) && r.at_end())) {
+                    invalid_line(fn, line_no, line);
+                }
+                Task *T; // Temporary pointer for task creation.
+                switch (act_type) {
+                    case 'P':
+                        T = &sink.add_periodic(phase, period, wcet, rel_dl);
+                        break;
+                    case 'A':
+                        T = &sink.add_aperiodic(phase, wcet);
+                        meta.fully_periodic = false;
+                        break;
+                    default:
+                        throw std::runtime_error(std::string(fn) + " Invalid task type on line " +
+                                                 std::to_string(line_no) + ": " + std::string(1, act_type));
+                }
+                T->set_id(id_counter++);
+            });
+        }
+
+        // Below this many bytes per thread, splitting a table costs more than it saves.
+        constexpr size_t MIN_PARALLEL_CHUNK_BYTES = 1 << 20;
+
+        // Why a schedule table line was rejected; see table_error().
+        enum class TableError { NONE, MALFORMED, BAD_TASK_ID, NOT_SORTED };
+
+        // Entries parsed from one newline-aligned piece of a schedule table.
+        // Parsing stops at the first bad line, which is remembered by its position in the file
+        // rather than its number: a chunk does not know how many lines precede it.
+        struct TableChunk {
+            std::string_view text;
+            std::vector<TaskScheduleEntry> entries;
+            std::string_view first_line; // line of entries.front()
+            TableError error{TableError::NONE};
+            std::string_view bad_line;
+            int64_t bad_task_id{0};
+        };
+
+        void parse_table_chunk(TableChunk &chunk) {
+            // Work on locals: stores through the vector would otherwise force `chunk` to be reloaded every line.
+            std::vector<TaskScheduleEntry> entries;
+            // At most one entry per line.
+            entries.reserve(static_cast<size_t>(std::count(chunk.text.begin(), chunk.text.end(), '\n')) + 1);
+            const char *p = chunk.text.data();
+            const char *const end = p + chunk.text.size();
+            TableError error = TableError::NONE;
+            std::string_view line;
+            int64_t task_id = 0;
+            while (p < end) {
+                const char *nl = static_cast<const char *>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+                const char *line_end = nl != nullptr ? nl : end;
+                line = chomp(std::string_view(p, static_cast<size_t>(line_end - p)));
+                p = line_end + 1;
+                if (line.empty() || line[0] == '#') continue;
+
+                FieldReader r(line);
+                time::TimeDuration start_time;
+                if (!(r.read_duration(start_time) && r.expect(',') && r.read_int(task_id) && r.at_end())) {
+                    error = TableError::MALFORMED;
                     break;
-                case 'A':
-                    T = new AperiodicTask(time::createTimeDurationMs(phase), time::createTimeDurationMs(wcet));
-                    meta.fully_periodic = false;
+                }
+                if (task_id < static_cast<int>(TaskID::RESET) || task_id > std::numeric_limits<int16_t>::max()) {
+                    error = TableError::BAD_TASK_ID;
                     break;
+                }
+                if (entries.empty()) {
+                    chunk.first_line = line;
+                } else if (start_time < entries.back().start_time) {
+                    error = TableError::NOT_SORTED;
+                    break;
+                }
+                entries.emplace_back(start_time, static_cast<int16_t>(task_id));
+            }
+            if (error != TableError::NONE) {
+                chunk.error = error;
+                chunk.bad_line = line;
+                chunk.bad_task_id = task_id;
+            }
+            chunk.entries = std::move(entries);
+        }
+
+        [[noreturn]] void table_error(std::string_view body, const TableChunk &chunk) {
+            constexpr const char *FN = "[io::read_task_table_from_csv]";
+            // Counting the lines is only paid for on the error path; the header is line 1.
+            size_t line_no = 2 + static_cast<size_t>(std::count(body.data(), chunk.bad_line.data(), '\n'));
+            switch (chunk.error) {
+                case TableError::BAD_TASK_ID:
+                    throw std::runtime_error(std::string(FN) + " Invalid task ID on line " + std::to_string(line_no) +
+                                             ": " + std::to_string(chunk.bad_task_id));
+                case TableError::NOT_SORTED:
+                    throw std::runtime_error(std::string(FN) + " Start time decreases on line " +
+                                             std::to_string(line_no) + ": " + std::string(chunk.bad_line));
                 default:
-                    throw std::runtime_error(
-                        "[io::read_task_list_from_csv] Invalid task type: " + std::string(1, act_type));
+                    invalid_line(FN, line_no, chunk.bad_line);
             }
-            T->set_id(id_counter++);
-            tasks.push_back(T);
         }
-        ifs.close();
+
+        // Splits `body` into about `n` pieces, each ending right after a newline (or at the end of `body`).
+        std::vector<TableChunk> split_at_lines(std::string_view body, size_t n) {
+            std::vector<TableChunk> chunks;
+            const size_t step = body.size() / n;
+            size_t begin = 0;
+            for (size_t i = 1; i <= n && begin < body.size(); i++) {
+                size_t end = body.size();
+                if (i < n) {
+                    size_t nl = body.find('\n', std::max(begin, i * step));
+                    end = nl == std::string_view::npos ? body.size() : nl + 1;
+                }
+                chunks.emplace_back();
+                chunks.back().text = body.substr(begin, end - begin);
+                begin = end;
+            }
+            return chunks;
+        }
+    }
+
+    void read_task_list_from_csv(std::vector<Task *> &tasks, const std::string &file_path, Metadata &meta) {
+        if (!tasks.empty()) {
+            throw std::runtime_error("[io::read_task_list_from_csv] std::vector<Task> passed has to be empty");
+        }
+        NewTasks sink{tasks};
+        try {
+            parse_task_list(file_path, meta, "[io::read_task_list_from_csv]", sink);
+        } catch (...) {
+            sink.discard();
+            throw;
+        }
+    }
+
+    void read_task_list_from_csv(TaskStore &store, const std::string &file_path, Metadata &meta) {
+        if (!store.empty()) {
+            throw std::runtime_error("[io::read_task_list_from_csv] TaskStore passed has to be empty");
+        }
+        try {
+            parse_task_list(file_path, meta, "[io::read_task_list_from_csv]", store);
+        } catch (...) {
+            store.release();
+            throw;
+        }
     }
 
     void read_task_list_from_csv(std::vector<PeriodicTask *> &periodic, std::vector<AperiodicTask *> &aperiodic,
@@ -69,67 +292,121 @@ namespace rtss::io {
         if (!aperiodic.empty()) {
             throw std::runtime_error("[io::read_task_list_from_csv] std::vector<AperiodicTask> passed has to be empty");
         }
-        std::ifstream ifs = _init_ifs_for_csv(file_path, "type,phase,period,wcet,rel_dl");
-        std::string line;
-        meta.fully_periodic = true;
-        Task *T; // Temporary pointer for task creation.
-        short id_counter = 1;
-        while (std::getline(ifs, line)) {
-            if (line.empty() || line[0] == '#')
-                continue;
-            std::istringstream iss(line);
-            char act_type, comma;
-            int phase, period, wcet, rel_dl;
-            if (!(iss >> act_type >> comma >> phase >> comma >> period >> comma >> wcet >> comma >> rel_dl)) {
-                throw std::runtime_error("[io::read_task_list_from_csv] Invalid CSV line: " + line);
-            }
-            switch (act_type) {
-                case 'P':
-                    T = new PeriodicTask(time::createTimeDurationMs(phase), time::createTimeDurationMs(period),
-                                         time::createTimeDurationMs(wcet), time::createTimeDurationMs(rel_dl));
-                    periodic.emplace_back(dynamic_cast<PeriodicTask *>(T));
-                    break;
-                case 'A':
-                    T = new AperiodicTask(time::createTimeDurationMs(phase), time::createTimeDurationMs(wcet));
-                    aperiodic.emplace_back(dynamic_cast<AperiodicTask *>(T));
-                    meta.fully_periodic = false;
-                    break;
-                default:
-                    throw std::runtime_error(
-                        "[io::read_task_list_from_csv] Invalid task type: " + std::string(1, act_type));
-            }
-            T->set_id(id_counter++);
+        NewTasksByType sink{periodic, aperiodic};
+        try {
+            parse_task_list(file_path, meta, "[io::read_task_list_from_csv]", sink);
+        } catch (...) {
+            sink.discard();
+            throw;
         }
-        ifs.close();
     }
 
-    void read_task_table_from_csv(TaskTableBuilder &tbl_builder, const std::string &file_path) {
+    void read_task_table_from_csv(TaskTableBuilder &tbl_builder, const std::string &file_path, size_t nthreads) {
         if (tbl_builder.size() != 0) {
             throw std::runtime_error("[io::read_task_table_from_csv] Passed non-empty task table builder to parser");
         }
-        std::ifstream ifs = _init_ifs_for_csv(file_path, "time,task_id");
-        std::string line;
-        while (std::getline(ifs, line)) {
-            if (line.empty() || line[0] == '#')
-                continue;
-            std::istringstream iss(line);
-            int time_ms;
-            int16_t task_id;
-            char comma;
-            if (!(iss >> time_ms >> comma >> task_id)) {
-                throw std::runtime_error("[io::read_task_table_from_csv] Invalid CSV line: " + line);
-            }
-            time::TimeDuration start_time = time::createTimeDurationMs(time_ms);
-            if (task_id == static_cast<int>(TaskID::IDLE)) {
-                tbl_builder.add_entry(static_cast<int16_t>(TaskID::IDLE), start_time);
-            } else if (task_id == static_cast<int>(TaskID::RESET)) {
-                tbl_builder.add_entry(static_cast<int16_t>(TaskID::RESET), start_time);
-            } else if (task_id > 0) {
-                tbl_builder.add_entry(task_id, start_time);
+        CsvFile csv = _map_csv(file_path, "time,task_id", "[io::read_task_table_from_csv]");
+        if (nthreads == 0) {
+            nthreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        // Small tables are not worth the threads.
+        nthreads = std::min(nthreads, std::max<size_t>(1, csv.body.size() / MIN_PARALLEL_CHUNK_BYTES));
+
+        // A few chunks per thread even out the load when some parts of the file have longer lines.
+        std::vector<TableChunk> chunks = split_at_lines(csv.body, nthreads == 1 ? 1 : 4 * nthreads);
+        if (nthreads == 1) {
+            for (auto &chunk: chunks) parse_table_chunk(chunk);
+        } else {
+            parallel::ThreadPool pool(nthreads);
+            for (auto &chunk: chunks) {
+                pool.submit([&chunk] { parse_table_chunk(chunk); });
+            }
+            pool.wait_idle();
+        }
+
+        // Concatenate in file order. Every chunk is sorted on its own, so only the
+        // boundaries between chunks are left to check.
+        if (chunks.size() > 1) {
+            size_t total = 0;
+            for (const auto &chunk: chunks) total += chunk.entries.size();
+            tbl_builder.reserve(total);
+        }
+        bool have_prev = false;
+        time::TimeDuration prev_tm{time::ZERO_DURATION};
+        for (auto &chunk: chunks) {
+            if (!chunk.entries.empty() && have_prev && chunk.entries.front().start_time < prev_tm) {
+                chunk.error = TableError::NOT_SORTED;
+                chunk.bad_line = chunk.first_line;
+            }
+            if (chunk.error != TableError::NONE) {
+                tbl_builder.clear();
+                table_error(csv.body, chunk);
+            }
+            if (!chunk.entries.empty()) {
+                have_prev = true;
+                prev_tm = chunk.entries.back().start_time;
+            }
+            tbl_builder.append(std::move(chunk.entries));
+            std::vector<TaskScheduleEntry>().swap(chunk.entries);
+        }
+    }
+
+    void write_task_list_csv(const std::vector<Task *> &tasks, const std::filesystem::path &csv_path) {
+        std::ofstream csv_ofs(csv_path, std::ios::binary);
+        if (!csv_ofs) {
+            throw std::runtime_error(
+                "[io::write_task_list_csv] Failed to open CSV file for writing: " + csv_path.string());
+        }
+        auto dur = [](time::TimeDuration d) {
+            char buf[time::MAX_DURATION_SZ];
+            return std::string(buf, put_csv_duration(buf, buf + sizeof(buf), d));
+        };
+        csv_ofs << "type,phase,period,wcet,rel_dl\n";
+        for (const Task *T: tasks) {
+            if (const auto *P = dynamic_cast<const PeriodicTask *>(T)) {
+                csv_ofs << "P," << dur(P->get_phase()) << ',' << dur(P->get_period()) << ',' << dur(P->get_wcet())
+                        << ',' << dur(P->get_rel_dl()) << '\n';
+            } else if (dynamic_cast<const AperiodicTask *>(T) != nullptr) {
+                csv_ofs << "A," << dur(T->get_phase()) << ",0," << dur(T->get_wcet()) << ",0\n";
             } else {
-                throw std::runtime_error("[io::read_task_table_from_csv] Invalid task ID: " + std::to_string(task_id));
+                throw std::runtime_error("[io::write_task_list_csv] Only periodic and aperiodic tasks can be written");
             }
         }
+        if (!csv_ofs) {
+            throw std::runtime_error("[io::write_task_list_csv] Failed to write " + csv_path.string());
+        }
+    }
+
+    void write_task_table_csv(const TaskTableBuilder &tbl_builder, const std::filesystem::path &csv_path) {
+        std::ofstream csv_ofs(csv_path, std::ios::binary);
+        if (!csv_ofs) {
+            throw std::runtime_error(
+                "[io::write_task_table_csv] Failed to open CSV file for writing: " + csv_path.string());
+        }
+        csv_ofs << "time,task_id\n";
+        // Generated tables can have millions of entries, so lines are formatted
+        // into a buffer with std::to_chars and written out in large blocks.
+        constexpr size_t BLOCK_SZ = 1 << 16;
+        constexpr size_t MAX_LINE_SZ = time::MAX_DURATION_SZ + 8;
+        std::string buf(BLOCK_SZ + MAX_LINE_SZ, '\0');
+        size_t len = 0;
+        for (const auto &se: tbl_builder.entries()) {
+            char *p = buf.data() + len;
+            char *end = buf.data() + buf.size();
+            p = put_csv_duration(p, end, se.start_time);
+            *p++ = ',';
+            p = std::to_chars(p, end, se.task_id).ptr;
+            *p++ = '\n';
+            len = p - buf.data();
+            if (len >= BLOCK_SZ) {
+                csv_ofs.write(buf.data(), static_cast<std::streamsize>(len));
+                len = 0;
+            }
+        }
+        csv_ofs.write(buf.data(), static_cast<std::streamsize>(len));
+        if (!csv_ofs) {
+            throw std::runtime_error("[io::write_task_table_csv] Failed to write " + csv_path.string());
+        }
     }
 
     void write_task_csv_from_stdin(const std::filesystem::path &csv_path) {
@@ -0,0 +1,58 @@
+#include "rtss/io/mapped_file.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rtss::io {
+    MappedFile::MappedFile(const std::string &file_path) {
+        int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("[io::MappedFile] Failed to open " + file_path);
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            throw std::runtime_error("[io::MappedFile] Not a regular file: " + file_path);
+        }
+        _size = static_cast<size_t>(st.st_size);
+        if (_size > 0) {
+            void *p = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("[io::MappedFile] Failed to map " + file_path);
+            }
+            // Parsers read front to back: ask for aggressive read-ahead.
+            ::madvise(p, _size, MADV_SEQUENTIAL);
+            _data = static_cast<const char *>(p);
+        }
+        ::close(fd);
+    }
+
+    MappedFile::~MappedFile() { unmap(); }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            unmap();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    void MappedFile::unmap() noexcept {
+        if (_data != nullptr) {
+            ::munmap(const_cast<char *>(_data), _size);
+            _data = nullptr;
+            _size = 0;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef RTSS_IO_TASK_SINKS_H
+#define RTSS_IO_TASK_SINKS_H
+
+#include <memory>
+#include <vector>
+
+#include "rtss/task.h"
+#include "rtss/time.h"
+
+// Sinks for the task list readers in input.cpp and binary.cpp, which create the tasks of a
+// file through reserve(n), add_periodic() and add_aperiodic(), as on a TaskStore.
+namespace rtss::io {
+    // Heap-allocated tasks for the caller to delete.
+    // * A reader that fails calls discard(), so the caller gets back an empty list.
+    struct NewTasks {
+        std::vector<Task *> &tasks;
+
+        void reserve(size_t n) { tasks.reserve(n); }
+
+        PeriodicTask &add_periodic(time::TimeDuration phase, time::TimeDuration period, time::TimeDuration wcet,
+                                   time::TimeDuration rel_dl) {
+            return add(std::make_unique<PeriodicTask>(phase, period, wcet, rel_dl));
+        }
+
+        AperiodicTask &add_aperiodic(time::TimeDuration arrival, time::TimeDuration wcet) {
+            return add(std::make_unique<AperiodicTask>(arrival, wcet));
+        }
+
+        void discard() noexcept {
+            for (Task *T: tasks) delete T;
+            tasks.clear();
+        }
+
+    private:
+        // The task is owned until it is in the list, so a failed push_back() does not leak it.
+        template<typename T>
+        T &add(std::unique_ptr<T> task) {
+            tasks.push_back(task.get());
+            return *task.release();
+        }
+    };
+
+    // Same, split by task type.
+    struct NewTasksByType {
+        std::vector<PeriodicTask *> &periodic;
+        std::vector<AperiodicTask *> &aperiodic;
+
+        void reserve(size_t) {}
+
+        PeriodicTask &add_periodic(time::TimeDuration phase, time::TimeDuration period, time::TimeDuration wcet,
+                                   time::TimeDuration rel_dl) {
+            auto task = std::make_unique<PeriodicTask>(phase, period, wcet, rel_dl);
+            periodic.push_back(task.get());
+            return *task.release();
+        }
+
+        AperiodicTask &add_aperiodic(time::TimeDuration arrival, time::TimeDuration wcet) {
+            auto task = std::make_unique<AperiodicTask>(arrival, wcet);
+            aperiodic.push_back(task.get());
+            return *task.release();
+        }
+
+        void discard() noexcept {
+            for (PeriodicTask *T: periodic) delete T;
+            for (AperiodicTask *T: aperiodic) delete T;
+            periodic.clear();
+            aperiodic.clear();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,217 @@
+#include "rtss/logging/event_log.h"
+
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "rtss/time.h"
+
+namespace rtss::logging {
+    namespace {
+        char *put_str(char *p, std::string_view s) {
+            s.copy(p, s.size());
+            return p + s.size();
+        }
+
+        char *put_task(char *p, char *end, int32_t id) {
+            *p++ = 'T';
+            return std::to_chars(p, end, id).ptr;
+        }
+
+        // Formats one record followed by '\n'; `p` has room for MAX_LINE_SZ characters.
+        char *format(char *p, char *end, const LogRecord &r) {
+            if (r.time_ns != LogRecord::NO_TIME) {
+                *p++ = '[';
+                p = time::put_duration_ns(p, end, r.time_ns);
+                p = put_str(p, "] ");
+            }
+            switch (r.kind) {
+                case EventKind::CYCLE_START:
+                    p = put_str(p, "---- Cycle ");
+                    p = std::to_chars(p, end, r.id).ptr;
+                    p = put_str(p, " ----");
+                    break;
+                case EventKind::HYPERPERIOD_START:
+                    p = put_str(p, "---- Hyperperiod ");
+                    p = std::to_chars(p, end, r.id).ptr;
+                    p = put_str(p, " ----");
+                    break;
+                case EventKind::HYPERPERIOD_END:
+                    p = put_str(p, "---- End of hyperperiod ----");
+                    break;
+                case EventKind::FRAME_START:
+                    p = put_str(p, "---- Frame ----");
+                    break;
+                case EventKind::PRIORITIES_ASSIGNED:
+                    p = put_str(p, "Assigned priorities.");
+                    break;
+                case EventKind::DISPATCH:
+                    p = put_str(p, "Running ");
+                    p = put_task(p, end, r.id);
+                    p = put_str(p, " for ");
+                    p = time::put_duration_ns(p, end, r.value_ns);
+                    break;
+                case EventKind::REMAINING:
+                    p = put_task(p, end, r.id);
+                    p = put_str(p, " remaining=");
+                    p = time::put_duration_ns(p, end, r.value_ns);
+                    break;
+                case EventKind::IDLE:
+                    p = put_str(p, "Idle until ");
+                    p = time::put_duration_ns(p, end, r.value_ns);
+                    break;
+                case EventKind::PREEMPT:
+                    p = put_task(p, end, r.id);
+                    p = put_str(p, " preempted by ");
+                    p = put_task(p, end, r.other_id);
+                    break;
+                case EventKind::DEADLINE_MISS:
+                    p = put_task(p, end, r.id);
+                    p = put_str(p, " missed its deadline at ");
+                    p = time::put_duration_ns(p, end, r.value_ns);
+                    break;
+            }
+            *p++ = '\n';
+            return p;
+        }
+
+        constexpr size_t MAX_LINE_SZ = 128;
+        constexpr size_t DRAIN_BATCH = 256;
+        // How long the drain thread sleeps when every ring is empty.
+        constexpr auto DRAIN_PERIOD = std::chrono::milliseconds(1);
+    }
+
+    TextSink::TextSink(const std::filesystem::path &path) : _file(path, std::ios::binary), _os(&_file) {
+        if (!_file) {
+            throw std::runtime_error("[logging::TextSink] Failed to open " + path.string());
+        }
+    }
+
+    void TextSink::write(const LogRecord *records, size_t n) {
+        std::string buf(DRAIN_BATCH * MAX_LINE_SZ, '\0');
+        size_t len = 0;
+        for (size_t k = 0; k < n; k++) {
+            if (len + MAX_LINE_SZ > buf.size()) {
+                _os->write(buf.data(), static_cast<std::streamsize>(len));
+                len = 0;
+            }
+            len = format(buf.data() + len, buf.data() + buf.size(), records[k]) - buf.data();
+        }
+        _os->write(buf.data(), static_cast<std::streamsize>(len));
+    }
+
+    BinarySink::BinarySink(const std::filesystem::path &path) : _file(path, std::ios::binary) {
+        if (!_file) {
+            throw std::runtime_error("[logging::BinarySink] Failed to open " + path.string());
+        }
+    }
+
+    void BinarySink::write(const LogRecord *records, size_t n) {
+        _file.write(reinterpret_cast<const char *>(records), static_cast<std::streamsize>(n * sizeof(LogRecord)));
+    }
+
+    thread_local EventLogger::ProducerCache EventLogger::_producer_cache;
+    std::atomic<uint64_t> EventLogger::_next_id{1};
+
+    EventLogger::EventLogger(size_t ring_capacity, bool drop_when_full)
+        : _id(_next_id.fetch_add(1, std::memory_order_relaxed)), _ring_capacity(ring_capacity),
+          _drop_when_full(drop_when_full) {
+        if (_ring_capacity == 0) {
+            throw std::runtime_error("[EventLogger::EventLogger] Ring capacity cannot be zero");
+        }
+        _drain_thread = std::thread(&EventLogger::drain_loop, this);
+    }
+
+    EventLogger::~EventLogger() {
+        {
+            std::lock_guard lock(_m);
+            _stop = true;
+        }
+        _drain_cv.notify_one();
+        _drain_thread.join();
+    }
+
+    EventLogger &EventLogger::global() {
+        // Destroyed at exit, which writes out whatever is still buffered.
+        static EventLogger logger;
+        static const bool has_sink = (logger.add_sink(std::make_unique<TextSink>(std::cout)), true);
+        (void) has_sink;
+        return logger;
+    }
+
+    void EventLogger::add_sink(std::unique_ptr<LogSink> sink) {
+        if (sink == nullptr) {
+            throw std::runtime_error("[EventLogger::add_sink] Sink cannot be null");
+        }
+        std::lock_guard lock(_m);
+        _sinks.push_back(std::move(sink));
+    }
+
+    void EventLogger::clear_sinks() {
+        flush();
+        std::lock_guard lock(_m);
+        _sinks.clear();
+    }
+
+    EventLogger::SpscRing *EventLogger::register_thread() {
+        std::lock_guard lock(_m);
+        const auto self = std::this_thread::get_id();
+        SpscRing *ring = nullptr;
+        for (auto &[tid, r]: _rings) {
+            if (tid == self) ring = r.get();
+        }
+        if (ring == nullptr) {
+            _rings.emplace_back(self, std::make_unique<SpscRing>(_ring_capacity));
+            ring = _rings.back().second.get();
+        }
+        _producer_cache = {_id, ring};
+        return ring;
+    }
+
+    void EventLogger::push_slow(SpscRing &ring, const LogRecord &record) {
+        if (_drop_when_full) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        _drain_cv.notify_one();
+        while (!ring.try_push(record)) {
+            std::this_thread::yield();
+        }
+    }
+
+    void EventLogger::flush() {
+        std::unique_lock lock(_m);
+        uint64_t ticket = ++_flush_requested;
+        _drain_cv.notify_one();
+        _flushed_cv.wait(lock, [&] { return _flush_done >= ticket; });
+    }
+
+    void EventLogger::drain_loop() {
+        std::vector<LogRecord> batch(DRAIN_BATCH);
+        std::unique_lock lock(_m);
+        while (true) {
+            // Records logged before a flush request are in the rings by now, so once
+            // this pass finds the rings empty, the request has been served.
+            const uint64_t requested = _flush_requested;
+            const bool stopping = _stop;
+            bool wrote = false;
+            for (auto &entry: _rings) {
+                size_t n;
+                while ((n = entry.second->pop(batch.data(), batch.size())) > 0) {
+                    for (auto &sink: _sinks) sink->write(batch.data(), n);
+                    wrote = true;
+                }
+            }
+            if (wrote) continue;
+            if (requested > _flush_done || stopping) {
+                for (auto &sink: _sinks) sink->flush();
+                _flush_done = requested;
+                _flushed_cv.notify_all();
+            }
+            if (stopping) return;
+            _drain_cv.wait_for(lock, DRAIN_PERIOD);
+        }
+    }
+}
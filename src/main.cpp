@@ -1,9 +1,16 @@
 #include <iostream>
 #include <vector>
 
+#include "rtss/analysis/frames.h"
+#include "rtss/analysis/partition.h"
+#include "rtss/analysis/qpa.h"
+#include "rtss/analysis/rta.h"
 #include "rtss/io/input.h"
 #include "rtss/schedulers/dynamic.h"
+#include "rtss/schedulers/partitioned.h"
 #include "rtss/schedulers/static.h"
+#include "rtss/schedulers/preemptive.h"
+#include "rtss/schedulers/table_generator.h"
 
 #include <fstream>
 
@@ -13,15 +20,56 @@ namespace rtss {
 
 using namespace rtss;
 
+static void report_rta(const std::vector<Task *> &tasks, const std::vector<size_t> &pri_idx) {
+    analysis::RTAParams params;
+    params.stop_at_first_miss = false;
+    auto result = analysis::response_time_analysis(tasks, pri_idx, params);
+    std::cout << "Response time analysis: " << (result.schedulable ? "schedulable" : "NOT schedulable") << "\n";
+    for (size_t idx: pri_idx) {
+        if (dynamic_cast<PeriodicTask *>(tasks[idx]) == nullptr) continue;
+        std::cout << "  T" << tasks[idx]->get_id() << ": R = ";
+        if (result.response_tm[idx] == analysis::RTAResult::UNBOUNDED) {
+            std::cout << "> D\n";
+        } else {
+            std::cout << time::to_string(result.response_tm[idx]) << "\n";
+        }
+    }
+}
+
+// Fill `tbl_builder` with a schedule table, either typed in or generated from the task set.
+static void load_task_table(std::vector<Task *> &tasks, const std::filesystem::path &tmp_dir,
+                            TaskTableBuilder &tbl_builder) {
+    std::filesystem::path tbl_path = tmp_dir / "rtss_task_table.csv";
+    std::cout << "Schedule table: 0) enter by hand, 1) generate with EDF, 2) RM, 3) DM, 4) LLF: ";
+    int source = 0;
+    std::cin >> source;
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    if (source < 1 || source > 4) {
+        io::write_task_table_csv_from_stdin(tbl_path);
+        std::cout << "Table written to : " << tbl_path << "\n";
+        io::read_task_table_from_csv(tbl_builder, tbl_path.string());
+        return;
+    }
+    constexpr schedulers::PreemptivePolicy policies[] = {
+        schedulers::PreemptivePolicy::EDF, schedulers::PreemptivePolicy::RM,
+        schedulers::PreemptivePolicy::DM, schedulers::PreemptivePolicy::LLF
+    };
+    auto stats = schedulers::generate_task_table(tasks, policies[source - 1], tbl_builder);
+    io::write_task_table_csv(tbl_builder, tbl_path);
+    std::cout << "Generated " << tbl_builder.size() << " entries (" << stats.deadline_misses
+            << " deadline misses), written to: " << tbl_path << "\n";
+}
+
 int main(int argc, char **argv) {
-    std::vector<Task *> tasks;
+    TaskStore store;
     io::Metadata meta;
     std::filesystem::path tmp_dir = std::filesystem::temp_directory_path();
     std::filesystem::path csv_path = tmp_dir / "rtss_tasks.csv";
     std::cout << "Enter task set (one per line); End input with an empty line.\n\n" << std::flush;
     io::write_task_csv_from_stdin(csv_path);
     std::cout << "Tasks written to: " << csv_path << "\n";
-    io::read_task_list_from_csv(tasks, csv_path.string(), meta);
+    io::read_task_list_from_csv(store, csv_path.string(), meta);
+    std::vector<Task *> tasks = store.tasks();
     std::cout << "Loaded " << tasks.size() << "tasks.\n";
     std::cout << "Select scheduling algorithm:\n"
             "  1) Rate Monotonic (RM)\n"
@@ -30,54 +78,147 @@ int main(int argc, char **argv) {
             "  4) Least Laxity First (LLF)\n"
             "  5) Table-Driven\n"
             "  6) Cyclic Executive\n"
-            "Enter choice (1-6): ";
+            "  7) Preemptive EDF\n"
+            "  8) Preemptive LLF\n"
+            "  9) Preemptive RM\n"
+            "  10) Preemptive DM\n"
+            "  11) Partitioned (multiprocessor)\n"
+            "Enter choice (1-11): ";
     int choice = 0;
     std::cin >> choice;
     // consume leftover newline so subsequent std::getline() in table input works
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
     schedulers::RTScheduler *scheduler;
+    std::unique_ptr<TaskTable> tbl; // Static schedulers keep a reference to it.
     switch (choice) {
-        case 1: scheduler = new schedulers::RM(tasks);
+        case 1: {
+            auto *rm = new schedulers::RM(tasks);
+            report_rta(tasks, rm->get_priority_order());
+            scheduler = rm;
             break;
-        case 2: scheduler = new schedulers::DM(tasks);
+        }
+        case 2: {
+            auto *dm = new schedulers::DM(tasks);
+            report_rta(tasks, dm->get_priority_order());
+            scheduler = dm;
             break;
-        case 3: scheduler = new schedulers::EDF(tasks);
+        }
+        case 3: {
+            auto qpa = analysis::qpa_edf(tasks);
+            std::cout << "EDF processor-demand analysis: " << (qpa.feasible ? "feasible" : "NOT feasible")
+                    << (qpa.exact ? "" : " (synchronous arrangement)") << "\n";
+            scheduler = new schedulers::EDF(tasks);
             break;
+        }
         case 4: scheduler = new schedulers::LLF(tasks);
             break;
         case 5: {
-            std::filesystem::path tbl_path = tmp_dir / "rtss_task_table.csv";
-            io::write_task_table_csv_from_stdin(tbl_path);
             TaskTableBuilder tbl_builder;
-            io::read_task_table_from_csv(tbl_builder, tbl_path.string());
-            TaskTable tbl = tbl_builder.build(StaticSchedulingMode::TASK_BASED);
-            scheduler = new schedulers::TableDrivenScheduler(tasks, tbl);
+            load_task_table(tasks, tmp_dir, tbl_builder);
+            tbl = std::make_unique<TaskTable>(tbl_builder.build(StaticSchedulingMode::TASK_BASED));
+            scheduler = new schedulers::TableDrivenScheduler(tasks, *tbl);
             break;
         }
         case 6: {
-            std::filesystem::path tbl_path = tmp_dir / "rtss_task_table.csv";
-            io::write_task_table_csv_from_stdin(tbl_path);
-            std::cout << "Table written to : " << tbl_path << "\n";
             TaskTableBuilder tbl_builder;
-            io::read_task_table_from_csv(tbl_builder, tbl_path.string());
-            std::cout << "Enter frame size (ms): ";
+            load_task_table(tasks, tmp_dir, tbl_builder);
+            std::cout << "Enter frame size (ms, 0 = choose automatically): ";
             int frame_ms;
             std::cin >> frame_ms;
-            TaskTable tbl = tbl_builder.build(
+            time::TimeDuration frame_sz = time::createTimeDurationMs(frame_ms);
+            if (frame_ms == 0) {
+                auto selection = analysis::select_frame_size(tasks);
+                if (!selection.found()) {
+                    std::cerr << "No frame size satisfies the frame constraints.\n";
+                    return 1;
+                }
+                std::cout << "Hyperperiod: " << time::to_string(selection.hyperperiod) << ", valid frame sizes (ms):";
+                for (auto f: selection.candidates) {
+                    std::cout << " " << std::chrono::duration<double, std::milli>(f).count();
+                }
+                frame_sz = selection.best;
+                std::cout << "\nUsing frame size " << std::chrono::duration<double, std::milli>(frame_sz).count()
+                        << "ms\n";
+            }
+            tbl = std::make_unique<TaskTable>(tbl_builder.build(
                 StaticSchedulingMode::FRAME_BASED,
-                time::createTimeDurationMs(frame_ms),
+                frame_sz,
                 tasks
-            );
-            scheduler = new schedulers::CyclicExecutiveScheduler(tasks, tbl, frame_ms);
+            ));
+            scheduler = new schedulers::CyclicExecutiveScheduler(tasks, *tbl);
+            break;
+        }
+        case 7: scheduler = new schedulers::PEDF(tasks);
+            break;
+        case 8: scheduler = new schedulers::PLLF(tasks);
+            break;
+        case 9: scheduler = new schedulers::PRM(tasks);
+            break;
+        case 10: scheduler = new schedulers::PDM(tasks);
+            break;
+        case 11: {
+            std::cout << "Number of cores: ";
+            size_t ncores = 0;
+            std::cin >> ncores;
+            std::cout << "Heuristic: 1) FF, 2) BF, 3) WF, 4) FFD, 5) BFD, 6) WFD: ";
+            int heuristic = 4;
+            std::cin >> heuristic;
+            std::cout << "Per-core scheduling: 1) EDF, 2) RM, 3) DM: ";
+            int policy = 1;
+            std::cin >> policy;
+            constexpr analysis::FitHeuristic heuristics[] = {
+                analysis::FitHeuristic::FIRST_FIT, analysis::FitHeuristic::BEST_FIT,
+                analysis::FitHeuristic::WORST_FIT, analysis::FitHeuristic::FIRST_FIT_DECREASING,
+                analysis::FitHeuristic::BEST_FIT_DECREASING, analysis::FitHeuristic::WORST_FIT_DECREASING
+            };
+            constexpr analysis::AcceptanceTest tests[] = {
+                analysis::AcceptanceTest::EDF, analysis::AcceptanceTest::RM, analysis::AcceptanceTest::DM
+            };
+            constexpr schedulers::PreemptivePolicy policies[] = {
+                schedulers::PreemptivePolicy::EDF, schedulers::PreemptivePolicy::RM, schedulers::PreemptivePolicy::DM
+            };
+            if (ncores == 0 || heuristic < 1 || heuristic > 6 || policy < 1 || policy > 3) {
+                std::cerr << "Invalid choice.\n";
+                return 1;
+            }
+            auto partition = analysis::partition_tasks(tasks, ncores, heuristics[heuristic - 1], tests[policy - 1]);
+            std::cout << partition.to_string(tasks);
+            if (!partition.feasible) {
+                std::cerr << "The tasks do not fit on " << ncores << " cores.\n";
+                return 1;
+            }
+            scheduler = new schedulers::PartitionedScheduler(tasks, partition, policies[policy - 1]);
             break;
         }
         default:
             std::cerr << "Invalid choice.\n";
             return 1;
     }
+    std::cout << "Simulate in virtual time? (y/n) ";
+    char virtual_tm = 'n';
+    std::cin >> virtual_tm;
+    if (virtual_tm == 'y' || virtual_tm == 'Y') {
+        scheduler->set_clock(std::make_unique<time::VirtualClock>());
+    } else {
+        std::cout << "Spin before each slot for precise wake-ups? (y/n) ";
+        char spin = 'n';
+        std::cin >> spin;
+        if (spin == 'y' || spin == 'Y') {
+            scheduler->set_clock(std::make_unique<time::RealClock>(time::WaitMode::HYBRID));
+        }
+    }
     std::cout << "How many cycles? ";
     size_t ncycles;
     std::cin >> ncycles;
     scheduler->run_scheduler(ncycles);
+    std::cout << "Finished at t = " << time::to_string(scheduler->get_clock().now()) << "\n";
+    auto *clock_based = dynamic_cast<schedulers::ClockBasedScheduler *>(scheduler);
+    if (clock_based != nullptr && !scheduler->get_clock().is_virtual()) {
+        const auto &jitter = clock_based->get_dispatch_jitter();
+        std::cout << "Dispatch jitter over " << jitter.count() << " slots: p50 = "
+                << static_cast<double>(jitter.value_at_percentile(50)) / 1000.0 << "us, p99 = "
+                << static_cast<double>(jitter.value_at_percentile(99)) / 1000.0 << "us, max = "
+                << static_cast<double>(jitter.max()) / 1000.0 << "us\n";
+    }
     return 0;
 }
@@ -0,0 +1,105 @@
+#include "rtss/metrics/histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace rtss::metrics {
+    HdrHistogram::HdrHistogram(int significant_digits) : _digits(significant_digits) {
+        if (significant_digits < 1 || significant_digits > 5) {
+            throw std::runtime_error("[HdrHistogram::HdrHistogram] Significant digits must be between 1 and 5");
+        }
+        // A bucket above the exact range spans 1 / 2^(_sub_bits-1) of its lowest value,
+        // which has to be below 10^-digits.
+        uint64_t resolution = 1;
+        for (int d = 0; d < significant_digits; d++) resolution *= 10;
+        _sub_bits = 1;
+        while ((uint64_t{1} << (_sub_bits - 1)) < resolution) _sub_bits++;
+    }
+
+    void HdrHistogram::Buckets::grow(size_t idx) {
+        if (counts.empty()) {
+            base = idx;
+            counts.assign(1, 0);
+        } else if (idx < base) {
+            const size_t new_base = idx - std::min(idx, std::max(base - idx, counts.size()));
+            counts.insert(counts.begin(), base - new_base, 0);
+            base = new_base;
+        } else {
+            counts.resize(std::max(idx - base + 1, 2 * counts.size()));
+        }
+    }
+
+    void HdrHistogram::Buckets::add(const Buckets &other) {
+        if (other.counts.empty()) return;
+        for (size_t idx: {other.base, other.end() - 1}) {
+            if (idx - base >= counts.size()) grow(idx);
+        }
+        for (size_t k = 0; k < other.counts.size(); k++) {
+            counts[other.base + k - base] += other.counts[k];
+        }
+    }
+
+    void HdrHistogram::merge(const HdrHistogram &other) {
+        if (other._digits != _digits) {
+            throw std::runtime_error("[HdrHistogram::merge] Histograms differ in precision");
+        }
+        if (other._count == 0) return;
+        _counts.add(other._counts);
+        _neg_counts.add(other._neg_counts);
+        _count += other._count;
+        _sum += other._sum;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+    }
+
+    void HdrHistogram::reset() noexcept {
+        _counts = Buckets{};
+        _neg_counts = Buckets{};
+        _count = 0;
+        _sum = 0.0;
+        _min = INT64_MAX;
+        _max = INT64_MIN;
+    }
+
+    uint64_t HdrHistogram::lowest_in(size_t idx) const noexcept {
+        const uint64_t sub_count = uint64_t{1} << _sub_bits, half = sub_count >> 1;
+        if (idx < sub_count) return idx;
+        const uint64_t j = idx - sub_count;
+        const unsigned shift = static_cast<unsigned>(j / half) + 1;
+        return (j % half + half) << shift;
+    }
+
+    uint64_t HdrHistogram::highest_in(size_t idx) const noexcept {
+        const uint64_t sub_count = uint64_t{1} << _sub_bits;
+        if (idx < sub_count) return idx;
+        const unsigned shift = static_cast<unsigned>((idx - sub_count) / (sub_count >> 1)) + 1;
+        return lowest_in(idx) + ((uint64_t{1} << shift) - 1);
+    }
+
+    int64_t HdrHistogram::value_at_percentile(double percentile) const {
+        if (!(percentile >= 0.0 && percentile <= 100.0)) {
+            throw std::runtime_error("[HdrHistogram::value_at_percentile] Percentile must be in [0, 100]");
+        }
+        if (_count == 0) return 0;
+        const auto rank = std::max<uint64_t>(
+            1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(_count))));
+        uint64_t seen = 0;
+        // Most negative values first, i.e. the negative buckets from the top down.
+        for (size_t k = _neg_counts.end(); k-- > _neg_counts.base;) {
+            seen += _neg_counts.counts[k - _neg_counts.base];
+            if (seen >= rank) {
+                // Highest value of the bucket, as for the non-negative ones.
+                const uint64_t lowest = lowest_in(k);
+                return std::clamp(lowest > INT64_MAX ? INT64_MIN : -static_cast<int64_t>(lowest), _min, _max);
+            }
+        }
+        for (size_t k = _counts.base; k < _counts.end(); k++) {
+            seen += _counts.counts[k - _counts.base];
+            if (seen >= rank) {
+                return std::clamp(static_cast<int64_t>(std::min<uint64_t>(highest_in(k), INT64_MAX)), _min, _max);
+            }
+        }
+        return _max;
+    }
+}
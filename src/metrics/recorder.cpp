@@ -0,0 +1,177 @@
+#include "rtss/metrics/recorder.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include "rtss/job.h"
+
+namespace rtss::metrics {
+    namespace {
+        time::TimeDuration abs_diff(time::TimeDuration a, time::TimeDuration b) noexcept {
+            return a > b ? a - b : b - a;
+        }
+
+        double to_ms(int64_t ns) noexcept { return static_cast<double>(ns) / 1e6; }
+    }
+
+    MetricsRecorder::MetricsRecorder(const std::vector<Task *> &tasks, int significant_digits)
+        : _digits(significant_digits), _tasks(tasks.size(), TaskMetrics(significant_digits)), _jobs(tasks.size()) {
+        _task_ids.reserve(tasks.size());
+        for (size_t i = 0; i < tasks.size(); i++) {
+            if (tasks[i] == nullptr) {
+                throw std::runtime_error("[MetricsRecorder::MetricsRecorder] Task pointer is null");
+            }
+            _task_ids.push_back(tasks[i]->get_id() != 0 ? tasks[i]->get_id() : static_cast<int32_t>(i + 1));
+        }
+    }
+
+    void MetricsRecorder::begin_run() {
+        _in_run = true;
+        std::fill(_running.begin(), _running.end(), schedulers::IDLE_TASK);
+        std::fill(_running_since.begin(), _running_since.end(), time::ZERO_DURATION);
+        for (auto &J: _jobs) J.started = false;
+    }
+
+    void MetricsRecorder::close_interval(size_t core, time::TimeDuration t) {
+        const size_t running = _running[core];
+        if (running == schedulers::IDLE_TASK || t <= _running_since[core]) return;
+        _tasks[running].exec_tm += t - _running_since[core];
+        _busy_tm += t - _running_since[core];
+    }
+
+    void MetricsRecorder::on_release(time::TimeDuration, size_t task_idx, time::TimeDuration) {
+        if (!_in_run) begin_run();
+        _tasks.at(task_idx).released_jobs++;
+    }
+
+    void MetricsRecorder::on_dispatch(time::TimeDuration t, size_t task_idx, size_t core) {
+        if (!_in_run) begin_run();
+        if (core >= _running.size()) {
+            _running.resize(core + 1, schedulers::IDLE_TASK);
+            _running_since.resize(core + 1, time::ZERO_DURATION);
+        }
+        close_interval(core, t);
+        _running[core] = task_idx;
+        _running_since[core] = t;
+        if (task_idx == schedulers::IDLE_TASK) return;
+        // The preemptive schedulers report a dispatch at the start of every job.
+        JobTrack &J = _jobs.at(task_idx);
+        if (!J.started) {
+            J.started = true;
+            J.start = t;
+        }
+    }
+
+    void MetricsRecorder::on_preempt(time::TimeDuration, size_t task_idx) {
+        if (!_in_run) begin_run();
+        _tasks.at(task_idx).preemptions++;
+    }
+
+    void MetricsRecorder::on_migrate(time::TimeDuration, size_t task_idx, size_t, size_t) {
+        if (!_in_run) begin_run();
+        _tasks.at(task_idx).migrations++;
+    }
+
+    void MetricsRecorder::on_complete(time::TimeDuration t, size_t task_idx, time::TimeDuration release,
+                                      time::TimeDuration abs_dl) {
+        if (!_in_run) begin_run();
+        TaskMetrics &M = _tasks.at(task_idx);
+        JobTrack &J = _jobs[task_idx];
+        M.completed_jobs++;
+        const time::TimeDuration response = t - release;
+        M.response_tm.record(time::to_ns(response));
+        if (abs_dl != NO_DEADLINE) M.lateness.record(time::to_ns(t - abs_dl));
+        if (J.started) {
+            const time::TimeDuration latency = J.start - release;
+            M.start_latency.record(time::to_ns(latency));
+            if (J.has_prev) {
+                M.start_jitter.record(time::to_ns(abs_diff(latency, J.prev_latency)));
+                M.finish_jitter.record(time::to_ns(abs_diff(response, J.prev_response)));
+            }
+            J.prev_latency = latency;
+            J.prev_response = response;
+            J.has_prev = true;
+        }
+        J.started = false;
+    }
+
+    void MetricsRecorder::on_deadline_miss(time::TimeDuration, size_t task_idx, time::TimeDuration) {
+        if (!_in_run) begin_run();
+        _tasks.at(task_idx).deadline_misses++;
+    }
+
+    void MetricsRecorder::on_finish(time::TimeDuration t) {
+        if (!_in_run) begin_run();
+        for (size_t core = 0; core < _running.size(); core++) {
+            close_interval(core, t);
+            _running[core] = schedulers::IDLE_TASK;
+        }
+        // Every run starts at time 0, when the scheduler resets its clock.
+        if (t > time::ZERO_DURATION) _elapsed += t;
+        _in_run = false;
+    }
+
+    void MetricsRecorder::reset() {
+        for (auto &M: _tasks) M = TaskMetrics(_digits);
+        for (auto &J: _jobs) J = JobTrack{};
+        _busy_tm = _elapsed = time::ZERO_DURATION;
+        _in_run = false;
+        _running.clear();
+        _running_since.clear();
+    }
+
+    TaskMetrics MetricsRecorder::total() const {
+        TaskMetrics all(_digits);
+        for (const auto &M: _tasks) {
+            all.released_jobs += M.released_jobs;
+            all.completed_jobs += M.completed_jobs;
+            all.deadline_misses += M.deadline_misses;
+            all.preemptions += M.preemptions;
+            all.migrations += M.migrations;
+            all.exec_tm += M.exec_tm;
+            all.response_tm.merge(M.response_tm);
+            all.lateness.merge(M.lateness);
+            all.start_latency.merge(M.start_latency);
+            all.start_jitter.merge(M.start_jitter);
+            all.finish_jitter.merge(M.finish_jitter);
+        }
+        return all;
+    }
+
+    double MetricsRecorder::utilisation() const noexcept {
+        if (_elapsed <= time::ZERO_DURATION || _running.empty()) return 0.0;
+        return static_cast<double>(_busy_tm.count()) /
+               (static_cast<double>(_elapsed.count()) * static_cast<double>(_running.size()));
+    }
+
+    std::string MetricsRecorder::to_string() const {
+        std::ostringstream oss;
+        oss << std::left << std::setw(8) << "task" << std::right
+                << std::setw(9) << "jobs" << std::setw(8) << "misses" << std::setw(9) << "preempt" << std::setw(9) << "migrate"
+                << std::setw(11) << "resp p50" << std::setw(11) << "resp p99" << std::setw(11) << "resp max"
+                << std::setw(11) << "late max" << std::setw(11) << "start jit" << std::setw(11) << "fin jit"
+                << std::setw(8) << "util" << "\n";
+        oss << std::fixed << std::setprecision(3);
+        for (size_t i = 0; i < _tasks.size(); i++) {
+            const TaskMetrics &M = _tasks[i];
+            const double util = _elapsed > time::ZERO_DURATION
+                                    ? 100.0 * static_cast<double>(M.exec_tm.count()) /
+                                      static_cast<double>(_elapsed.count())
+                                    : 0.0;
+            oss << std::left << std::setw(8) << ("T" + std::to_string(_task_ids[i])) << std::right
+                    << std::setw(9) << M.completed_jobs << std::setw(8) << M.deadline_misses
+                    << std::setw(9) << M.preemptions << std::setw(9) << M.migrations
+                    << std::setw(11) << to_ms(M.response_tm.value_at_percentile(50))
+                    << std::setw(11) << to_ms(M.response_tm.value_at_percentile(99))
+                    << std::setw(11) << to_ms(M.response_tm.max())
+                    << std::setw(11) << to_ms(M.lateness.max())
+                    << std::setw(11) << to_ms(M.start_jitter.max())
+                    << std::setw(11) << to_ms(M.finish_jitter.max())
+                    << std::setw(7) << std::setprecision(1) << util << "%" << std::setprecision(3) << "\n";
+        }
+        oss << "CPU utilisation: " << std::setprecision(1) << 100.0 * utilisation() << "%\n";
+        return oss.str();
+    }
+}
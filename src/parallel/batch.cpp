@@ -0,0 +1,140 @@
+#include "rtss/parallel/batch.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "rtss/clock.h"
+
+namespace rtss::parallel {
+    BatchSummary::BatchSummary(std::vector<BatchResult> &&results,
+                               const std::vector<schedulers::PreemptivePolicy> &policies)
+        : _results(std::move(results)), _per_policy(policies.size()) {
+        for (size_t p = 0; p < policies.size(); p++) {
+            _per_policy[p].policy = policies[p];
+        }
+        for (size_t k = 0; k < _results.size(); k++) {
+            const BatchResult &r = _results[k];
+            PolicySummary &s = _per_policy[k % policies.size()];
+            s.nsets++;
+            if (!r.error.empty()) {
+                s.nerrors++;
+                continue;
+            }
+            if (r.schedulable) s.nschedulable++;
+            s.deadline_misses += r.stats.deadline_misses;
+            s.preemptions += r.stats.preemptions;
+        }
+    }
+
+    std::string BatchSummary::to_string() const {
+        std::ostringstream oss;
+        oss << std::left << std::setw(8) << "policy" << std::right
+                << std::setw(10) << "sets" << std::setw(13) << "schedulable" << std::setw(9) << "ratio"
+                << std::setw(12) << "misses" << std::setw(14) << "preemptions" << std::setw(8) << "errors" << "\n";
+        for (const auto &s: _per_policy) {
+            size_t nrun = s.nsets - s.nerrors;
+            double ratio = nrun > 0 ? 100.0 * static_cast<double>(s.nschedulable) / static_cast<double>(nrun) : 0.0;
+            oss << std::left << std::setw(8) << schedulers::to_string(s.policy) << std::right
+                    << std::setw(10) << s.nsets << std::setw(13) << s.nschedulable
+                    << std::setw(8) << std::fixed << std::setprecision(1) << ratio << "%"
+                    << std::setw(12) << s.deadline_misses << std::setw(14) << s.preemptions
+                    << std::setw(8) << s.nerrors << "\n";
+        }
+        return oss.str();
+    }
+
+    PartitionSummary::PartitionSummary(std::vector<PartitionResult> &&results,
+                                       const std::vector<analysis::FitHeuristic> &heuristics,
+                                       analysis::AcceptanceTest test)
+        : _results(std::move(results)), _per_heuristic(heuristics.size()), _test(test) {
+        for (size_t h = 0; h < heuristics.size(); h++) {
+            _per_heuristic[h].heuristic = heuristics[h];
+        }
+        for (size_t k = 0; k < _results.size(); k++) {
+            const PartitionResult &r = _results[k];
+            HeuristicSummary &s = _per_heuristic[k % heuristics.size()];
+            s.nsets++;
+            if (!r.error.empty()) {
+                s.nerrors++;
+                continue;
+            }
+            if (r.partition.feasible) s.nfeasible++;
+            s.unassigned += r.partition.unassigned;
+            s.exact_tests += r.partition.exact_tests;
+        }
+    }
+
+    std::string PartitionSummary::to_string() const {
+        std::ostringstream oss;
+        oss << std::left << std::setw(10) << "heuristic" << std::right
+                << std::setw(8) << "sets" << std::setw(10) << "feasible" << std::setw(9) << "ratio"
+                << std::setw(12) << "unassigned" << std::setw(13) << "exact tests" << std::setw(8) << "errors"
+                << "  (" << analysis::to_string(_test) << " test)\n";
+        for (const auto &s: _per_heuristic) {
+            size_t nrun = s.nsets - s.nerrors;
+            double ratio = nrun > 0 ? 100.0 * static_cast<double>(s.nfeasible) / static_cast<double>(nrun) : 0.0;
+            oss << std::left << std::setw(10) << analysis::to_string(s.heuristic) << std::right
+                    << std::setw(8) << s.nsets << std::setw(10) << s.nfeasible
+                    << std::setw(8) << std::fixed << std::setprecision(1) << ratio << "%"
+                    << std::setw(12) << s.unassigned << std::setw(13) << s.exact_tests
+                    << std::setw(8) << s.nerrors << "\n";
+        }
+        return oss.str();
+    }
+
+    BatchSummary BatchRunner::run(std::vector<std::vector<Task *> > &task_sets,
+                                  const std::vector<schedulers::PreemptivePolicy> &policies, size_t nhyperperiods) {
+        if (policies.empty()) {
+            throw std::runtime_error("[BatchRunner::run] No policies given");
+        }
+        const size_t npolicies = policies.size();
+        std::vector<BatchResult> results(task_sets.size() * npolicies);
+        for (size_t s = 0; s < task_sets.size(); s++) {
+            for (size_t p = 0; p < npolicies; p++) {
+                BatchResult &r = results[s * npolicies + p];
+                r.set_idx = s;
+                r.policy = policies[p];
+                _pool.submit([&r, &tasks = task_sets[s], nhyperperiods] {
+                    try {
+                        auto scheduler = schedulers::make_preemptive_scheduler(tasks, r.policy);
+                        scheduler->set_clock(std::make_unique<time::VirtualClock>());
+                        scheduler->set_verbose(false);
+                        scheduler->run_scheduler(nhyperperiods);
+                        r.stats = scheduler->get_stats();
+                        r.schedulable = r.stats.deadline_misses == 0;
+                    } catch (const std::exception &e) {
+                        r.error = e.what();
+                    }
+                });
+            }
+        }
+        _pool.wait_idle();
+        return {std::move(results), policies};
+    }
+
+    PartitionSummary BatchRunner::run_partitioning(const std::vector<std::vector<Task *> > &task_sets, size_t ncores,
+                                                   const std::vector<analysis::FitHeuristic> &heuristics,
+                                                   analysis::AcceptanceTest test) {
+        if (heuristics.empty()) {
+            throw std::runtime_error("[BatchRunner::run_partitioning] No heuristics given");
+        }
+        const size_t nheuristics = heuristics.size();
+        std::vector<PartitionResult> results(task_sets.size() * nheuristics);
+        for (size_t s = 0; s < task_sets.size(); s++) {
+            for (size_t h = 0; h < nheuristics; h++) {
+                PartitionResult &r = results[s * nheuristics + h];
+                r.set_idx = s;
+                r.heuristic = heuristics[h];
+                _pool.submit([&r, &tasks = task_sets[s], ncores, test] {
+                    try {
+                        r.partition = analysis::partition_tasks(tasks, ncores, r.heuristic, test);
+                    } catch (const std::exception &e) {
+                        r.error = e.what();
+                    }
+                });
+            }
+        }
+        _pool.wait_idle();
+        return {std::move(results), heuristics, test};
+    }
+}
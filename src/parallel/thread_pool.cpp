@@ -0,0 +1,114 @@
+#include "rtss/parallel/thread_pool.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace rtss::parallel {
+    namespace {
+        // Pool and queue index of the calling worker thread.
+        thread_local const ThreadPool *tls_pool = nullptr;
+        thread_local size_t tls_queue = 0;
+    }
+
+    ThreadPool::ThreadPool(size_t nthreads) {
+        if (nthreads == 0) {
+            nthreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        _queues.reserve(nthreads);
+        for (size_t i = 0; i < nthreads; i++) {
+            _queues.push_back(std::make_unique<WorkQueue>());
+        }
+        _threads.reserve(nthreads);
+        for (size_t i = 0; i < nthreads; i++) {
+            _threads.emplace_back(&ThreadPool::worker_loop, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::unique_lock<std::mutex> lock(_m);
+            _idle_cv.wait(lock, [this] { return _unfinished.load() == 0; });
+            _stop = true;
+        }
+        _work_cv.notify_all();
+        for (auto &t: _threads) {
+            t.join();
+        }
+    }
+
+    void ThreadPool::submit(std::function<void()> job) {
+        if (!job) {
+            throw std::runtime_error("[ThreadPool::submit] Job cannot be empty");
+        }
+        size_t q = tls_pool == this ? tls_queue : _next_queue.fetch_add(1) % _queues.size();
+        _unfinished++;
+        {
+            std::lock_guard<std::mutex> lock(_queues[q]->m);
+            _queues[q]->jobs.push_back(std::move(job));
+        }
+        {
+            // Counting under _m pairs with the predicate check in worker_loop, so no wakeup is lost.
+            std::lock_guard<std::mutex> lock(_m);
+            _queued++;
+        }
+        _work_cv.notify_one();
+    }
+
+    void ThreadPool::wait_idle() {
+        std::unique_lock<std::mutex> lock(_m);
+        _idle_cv.wait(lock, [this] { return _unfinished.load() == 0; });
+        if (_error) {
+            std::exception_ptr error = _error;
+            _error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    bool ThreadPool::try_pop(size_t self, std::function<void()> &job) {
+        {
+            WorkQueue &own = *_queues[self];
+            std::lock_guard<std::mutex> lock(own.m);
+            if (!own.jobs.empty()) {
+                job = std::move(own.jobs.back());
+                own.jobs.pop_back();
+                return true;
+            }
+        }
+        for (size_t k = 1; k < _queues.size(); k++) {
+            WorkQueue &victim = *_queues[(self + k) % _queues.size()];
+            std::lock_guard<std::mutex> lock(victim.m);
+            if (!victim.jobs.empty()) {
+                job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ThreadPool::worker_loop(size_t self) {
+        tls_pool = this;
+        tls_queue = self;
+        std::function<void()> job;
+        while (true) {
+            if (try_pop(self, job)) {
+                _queued--;
+                try {
+                    job();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(_m);
+                    if (!_error) _error = std::current_exception();
+                }
+                job = nullptr;
+                if (--_unfinished == 0) {
+                    std::lock_guard<std::mutex> lock(_m);
+                    _idle_cv.notify_all();
+                }
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_m);
+            _work_cv.wait(lock, [this] { return _stop || _queued.load() > 0; });
+            if (_stop && _queued.load() <= 0) return;
+        }
+    }
+}
@@ -1,111 +1,74 @@
 #include "rtss/schedulers/dynamic.h"
 
-#include <numeric>
-#include <iostream>
+#include <algorithm>
 
 namespace rtss::schedulers {
-    void PriorityBasedScheduler::assign_priorities(std::vector<size_t> &idx) {
-        const size_t n = this->tasks.size();
-        if (n == 0) return;
-
-        // sort indices so original `tasks` order is preserved
-        std::iota(idx.begin(), idx.end(), 0);
-
-        std::sort(idx.begin(), idx.end(),
-                  [this](size_t ia, size_t ib) -> bool {
-                      Task *a = this->tasks[ia];
-                      Task *b = this->tasks[ib];
-
-                      auto pa = dynamic_cast<PeriodicTask *>(a);
-                      auto pb = dynamic_cast<PeriodicTask *>(b);
-
-                      if (pa && pb) {
-                          return this->compare(pa, pb);
-                      }
-                      if (pa && !pb) {
-                          return true; // periodic tasks before non-periodic
-                      }
-                      if (!pa && pb) {
-                          return false;
-                      }
-                      // fallback: compare WCET
-                      return a->get_wcet() < b->get_wcet();
-                  });
-
-        // // assign priorities (1 = highest here)
-        // for (size_t rank = 0; rank < n; ++rank) {
-        //     set_task_priority(idx[rank], static_cast<int>(rank + 1));
-        // }
-    }
-
     void PriorityBasedScheduler::run_scheduler(size_t ncycles) {
         if (ncycles == 0) return;
 
         size_t cycle_counter = 0;
+        this->sim_clock->reset();
+        for (size_t i = 0; i < this->tasks.size(); i++) {
+            this->task_set.set_rem_tm(i, this->tasks[i]->get_rem_tm());
+        }
         if (this->_priority_mode == PriorityMode::FIXED) {
             assign_priorities(this->pri_idx);
-            std::cout << "Assigned priorities." << std::endl;
+            log_event<logging::LogLevel::EVENTS>(logging::EventKind::PRIORITIES_ASSIGNED);
         }
         while (cycle_counter < ncycles) {
-            std::cout << "---- Cycle " << cycle_counter + 1 << " ----" << std::endl;
+            log_event<logging::LogLevel::EVENTS>(logging::EventKind::CYCLE_START,
+                                                 static_cast<int32_t>(cycle_counter + 1));
             if (this->_priority_mode == PriorityMode::DYNAMIC) {
                 assign_priorities(this->pri_idx);
-                std::cout << "Assigned priorities." << std::endl;
+                log_event<logging::LogLevel::EVENTS>(logging::EventKind::PRIORITIES_ASSIGNED);
             }
             bool progress = true;
             while (progress) {
                 progress = false;
-                auto now = time::Clock::now().time_since_epoch();
+                auto now = this->sim_clock->now();
+                // Earliest release among the unfinished tasks that are not ready yet.
+                time::TimeDuration next_release = time::TimeDuration::max();
 
                 for (size_t idx: pri_idx) {
-                    Task *t = this->tasks[idx];
+                    if (task_set.rem_tm(idx) == time::TimeDuration::zero()) continue; // already finished
 
-                    if (t->get_rem_tm() == time::TimeDuration::zero()) continue; // already finished
-
-                    bool ready = false;
-                    if (auto *pt = dynamic_cast<PeriodicTask *>(t)) {
-                        // treat task as available if current time >= phase (first release)
-                        ready = (now >= pt->get_phase());
-                    } else if (auto *at = dynamic_cast<AperiodicTask *>(t)) {
-                        ready = (now >= at->get_arrival());
-                    } else {
-                        ready = (now >= t->get_phase());
+                    // A periodic task is available from its first release, an aperiodic one from its arrival;
+                    // both are the phase.
+                    if (now < task_set.phase(idx)) {
+                        next_release = std::min(next_release, task_set.phase(idx));
+                        continue;
                     }
 
-                    if (!ready) continue;
-
+                    Task *t = this->tasks[idx];
                     // run the task to completion (consume remaining time)
-                    time::TimeDuration exec = t->get_rem_tm();
-                    std::cout << "Running T" << t->get_id() << " for " << time::toInt(exec) << "ms" << std::endl;
-                    t->run_task(exec);
-                    std::cout << "T" << t->get_id() << " remaining=" << time::toInt(t->get_rem_tm()) << "ms" <<
-                            std::endl;
+                    time::TimeDuration exec = task_set.rem_tm(idx);
+                    log_event<logging::LogLevel::JOBS>(logging::EventKind::DISPATCH, t->get_id(), exec);
+                    for (auto *o: observers) o->on_dispatch(now, idx, 0);
+                    t->run_task(exec, *this->sim_clock);
+                    task_set.set_rem_tm(idx, t->get_rem_tm());
+                    log_event<logging::LogLevel::DEBUG>(logging::EventKind::REMAINING, t->get_id(), t->get_rem_tm());
 
                     progress = true;
                     // after running one job, re-evaluate readiness/priorities in the next loop iteration
                     break;
                 }
+                if (!progress && next_release != time::TimeDuration::max()) {
+                    // Nothing is ready: idle until the next release instead of dropping the pending tasks.
+                    for (auto *o: observers) o->on_dispatch(now, IDLE_TASK, 0);
+                    this->sim_clock->advance_until(next_release);
+                    progress = true;
+                }
             }
             for (auto *t: this->tasks) {
                 t->reset();
             }
+            task_set.reset();
             cycle_counter++;
         }
-    }
-
-    bool RateMonotonicScheduler::compare(PeriodicTask *P1, PeriodicTask *P2) {
-        return P1->get_period() < P2->get_period();
-    }
-
-    bool DeadlineMonotonicScheduler::compare(PeriodicTask *P1, PeriodicTask *P2) {
-        return P1->get_rel_dl() < P2->get_rel_dl();
-    }
-
-    bool EarliestDeadlineFirstScheduler::compare(PeriodicTask *P1, PeriodicTask *P2) {
-        return P1->calc_abs_dl() < P2->calc_abs_dl();
-    }
-
-    bool LeastLaxityFirstScheduler::compare(PeriodicTask *P1, PeriodicTask *P2) {
-        return P1->calc_laxity() < P2->calc_laxity();
+        if (!observers.empty()) {
+            const time::TimeDuration now = this->sim_clock->now();
+            for (auto *o: observers) o->on_finish(now);
+        }
+        flush_log();
     }
 }
@@ -0,0 +1,259 @@
+#include "rtss/schedulers/global.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "rtss/analysis/arith.h"
+#include "rtss/containers/indexed_heap.h"
+#include "rtss/schedulers/dynamic.h"
+
+namespace rtss::schedulers {
+    namespace {
+        constexpr size_t NO_TASK = SIZE_MAX;
+        constexpr size_t NO_CORE = SIZE_MAX;
+
+        // (0 for a zero-laxity job under EDZL, 1 otherwise; policy key). Lower runs first.
+        using Priority = std::pair<int64_t, int64_t>;
+    }
+
+    GlobalScheduler::GlobalScheduler(std::vector<Task *> &tasks, size_t ncores, GlobalPolicy policy)
+        : PreemptiveScheduler(tasks), ncores(ncores), policy(policy) {
+        if (ncores == 0) {
+            throw std::runtime_error("[GlobalScheduler::GlobalScheduler] Core count cannot be zero");
+        }
+        if (tasks.empty() || (policy != GlobalPolicy::RM && policy != GlobalPolicy::DM)) return;
+        const std::vector<size_t> pri_idx = policy == GlobalPolicy::RM
+                                                ? RateMonotonicScheduler(tasks).get_priority_order()
+                                                : DeadlineMonotonicScheduler(tasks).get_priority_order();
+        pri_level.assign(tasks.size(), 0);
+        for (size_t level = 0; level < pri_idx.size(); level++) {
+            pri_level[pri_idx[level]] = level;
+        }
+    }
+
+    void GlobalScheduler::run_scheduler(size_t nhyperperiods) {
+        const size_t n = jobs.size();
+        stats = SimulationStats{};
+        stats.max_response_tm.assign(n, time::ZERO_DURATION);
+        this->sim_clock->reset();
+        clear_jobs();
+        if (nhyperperiods == 0 || n == 0) return;
+
+        int64_t horizon_cnt;
+        if (!analysis::checked_mul(hyperperiod.count(), static_cast<int64_t>(nhyperperiods), horizon_cnt)) {
+            throw std::overflow_error("[GlobalScheduler::run_scheduler] Simulation horizon overflows");
+        }
+        const time::TimeDuration horizon(horizon_cnt);
+        const bool edzl = policy == GlobalPolicy::EDZL;
+
+        std::vector<char> zero_laxity(n, 0);
+        auto priority = [&](size_t i) -> Priority {
+            const int64_t cls = zero_laxity[i] ? 0 : 1;
+            if (!pri_level.empty()) return {cls, static_cast<int64_t>(pri_level[i])};
+            return {cls, jobs[i].current().abs_dl.count()};
+        };
+        // Whether job a runs before job b; ties go to the lower index, as in the waiting queue.
+        auto before = [&](size_t a, size_t b) {
+            const Priority pa = priority(a), pb = priority(b);
+            return pa < pb || (pa == pb && a < b);
+        };
+
+        // Release time of each task's next job.
+        containers::IndexedHeap<time::TimeDuration> releases(n);
+        for (size_t i = 0; i < n; i++) {
+            if (jobs[i].phase < horizon) {
+                releases.push(i, jobs[i].phase);
+            }
+        }
+        // Active jobs not on a core.
+        containers::IndexedHeap<Priority> waiting(n);
+        // EDZL: when each waiting job with a deadline reaches zero laxity.
+        containers::IndexedHeap<time::TimeDuration> zero_laxity_at(edzl ? n : 0);
+        std::vector<size_t> on_core(ncores, NO_TASK);
+        // Core the current job of each task last ran on.
+        std::vector<size_t> last_core(n, NO_CORE);
+        // Task each core was last reported running, and whether it has to be reported again
+        // (at the start and after a completion).
+        std::vector<size_t> reported(ncores, NO_TASK);
+        std::vector<char> report(ncores, 1);
+
+        time::TimeDuration now = time::ZERO_DURATION;
+        auto make_waiting = [&](size_t i) {
+            waiting.push(i, priority(i));
+            const Job &J = jobs[i].current();
+            if (edzl && !zero_laxity[i] && J.abs_dl != NO_DEADLINE) {
+                zero_laxity_at.push(i, J.abs_dl - J.rem_tm);
+            }
+        };
+        // The current job of task i has changed.
+        auto start_job = [&](size_t i) {
+            zero_laxity[i] = 0;
+            last_core[i] = NO_CORE;
+            make_waiting(i);
+        };
+        auto place = [&](size_t i, size_t core) {
+            waiting.erase(i);
+            if (edzl && zero_laxity_at.contains(i)) zero_laxity_at.erase(i);
+            on_core[core] = i;
+            if (last_core[i] != NO_CORE && last_core[i] != core) {
+                stats.migrations++;
+                for (auto *o: observers) o->on_migrate(now, i, last_core[i], core);
+            }
+            last_core[i] = core;
+        };
+
+        while (true) {
+            while (!releases.empty() && releases.key(releases.top()) <= now) {
+                size_t i = releases.top();
+                JobState &J = jobs[i];
+                time::TimeDuration release = releases.key(i);
+                stats.released_jobs++;
+                const bool was_active = J.active();
+                const Job &job = release_job(i, release);
+                if (!was_active) {
+                    start_job(i);
+                }
+                for (auto *o: observers) o->on_release(release, i, job.abs_dl);
+                if (J.periodic && release + J.period < horizon) {
+                    releases.update(i, release + J.period);
+                } else {
+                    releases.erase(i);
+                }
+            }
+            if (now >= horizon) break;
+
+            while (edzl && !zero_laxity_at.empty() && zero_laxity_at.key(zero_laxity_at.top()) <= now) {
+                size_t i = zero_laxity_at.top();
+                zero_laxity_at.pop();
+                zero_laxity[i] = 1;
+                waiting.update(i, priority(i));
+            }
+
+            // Free cores go to the best waiting jobs, then waiting jobs better than the worst
+            // running one preempt it, until the cores hold the ncores best jobs.
+            size_t nfree = static_cast<size_t>(std::count(on_core.begin(), on_core.end(), NO_TASK));
+            while (!waiting.empty()) {
+                const size_t i = waiting.top();
+                size_t core = NO_CORE;
+                if (nfree > 0) {
+                    if (last_core[i] != NO_CORE && on_core[last_core[i]] == NO_TASK) {
+                        core = last_core[i];
+                    } else {
+                        core = static_cast<size_t>(std::find(on_core.begin(), on_core.end(), NO_TASK) - on_core.begin());
+                    }
+                    nfree--;
+                } else {
+                    core = 0;
+                    for (size_t k = 1; k < ncores; k++) {
+                        if (before(on_core[core], on_core[k])) core = k;
+                    }
+                    const size_t victim = on_core[core];
+                    if (!before(i, victim)) break;
+                    on_core[core] = NO_TASK;
+                    stats.preemptions++;
+                    for (auto *o: observers) o->on_preempt(now, victim);
+                    log_event<logging::LogLevel::JOBS>(now, logging::EventKind::PREEMPT,
+                                                       this->tasks[victim]->get_id(), time::ZERO_DURATION,
+                                                       this->tasks[i]->get_id());
+                    make_waiting(victim);
+                }
+                place(i, core);
+            }
+
+            time::TimeDuration next_event = horizon;
+            if (!releases.empty()) {
+                next_event = std::min(next_event, releases.key(releases.top()));
+            }
+            if (edzl && !zero_laxity_at.empty()) {
+                next_event = std::min(next_event, std::max(now, zero_laxity_at.key(zero_laxity_at.top())));
+            }
+            for (size_t i: on_core) {
+                if (i != NO_TASK) next_event = std::min(next_event, now + jobs[i].current().rem_tm);
+            }
+
+            bool busy = false;
+            for (size_t core = 0; core < ncores; core++) {
+                const size_t i = on_core[core];
+                if (report[core] || reported[core] != i) {
+                    report[core] = 0;
+                    reported[core] = i;
+                    for (auto *o: observers) o->on_dispatch(now, i == NO_TASK ? IDLE_TASK : i, core);
+                }
+                if (i == NO_TASK) continue;
+                busy = true;
+                log_event<logging::LogLevel::JOBS>(now, logging::EventKind::DISPATCH, this->tasks[i]->get_id(),
+                                                   next_event - now);
+            }
+            if (!busy) {
+                log_event<logging::LogLevel::JOBS>(now, logging::EventKind::IDLE, 0, next_event);
+            }
+
+            this->sim_clock->advance_until(next_event);
+            const time::TimeDuration elapsed = next_event - now;
+            now = next_event;
+            for (size_t core = 0; core < ncores; core++) {
+                const size_t i = on_core[core];
+                if (i == NO_TASK) continue;
+                Job &J = jobs[i].current();
+                J.rem_tm -= elapsed;
+                if (J.rem_tm > time::ZERO_DURATION) continue;
+
+                // Job completed.
+                on_core[core] = NO_TASK;
+                report[core] = 1;
+                stats.completed_jobs++;
+                stats.max_response_tm[i] = std::max(stats.max_response_tm[i], now - J.release);
+                for (auto *o: observers) o->on_complete(now, i, J.release, J.abs_dl);
+                if (now > J.abs_dl) {
+                    stats.deadline_misses++;
+                    for (auto *o: observers) o->on_deadline_miss(now, i, J.abs_dl);
+                    log_event<logging::LogLevel::EVENTS>(now, logging::EventKind::DEADLINE_MISS,
+                                                         this->tasks[i]->get_id(), J.abs_dl);
+                }
+                retire_job(i);
+                if (jobs[i].active()) {
+                    start_job(i);
+                }
+            }
+        }
+
+        // Unfinished jobs whose deadlines have already passed count as misses.
+        for (size_t i = 0; i < n; i++) {
+            for (const Job *job = jobs[i].pending.head(); job != nullptr; job = job->next) {
+                if (job->abs_dl <= horizon) {
+                    stats.deadline_misses++;
+                    for (auto *o: observers) o->on_deadline_miss(horizon, i, job->abs_dl);
+                }
+            }
+        }
+        clear_jobs();
+        for (auto *o: observers) o->on_finish(now);
+        flush_log();
+    }
+
+    const char *to_string(GlobalPolicy policy) noexcept {
+        switch (policy) {
+            case GlobalPolicy::EDF: return "G-EDF";
+            case GlobalPolicy::RM: return "G-RM";
+            case GlobalPolicy::DM: return "G-DM";
+            case GlobalPolicy::EDZL: return "EDZL";
+            default: return "?";
+        }
+    }
+
+    std::unique_ptr<GlobalScheduler> make_global_scheduler(std::vector<Task *> &tasks, size_t ncores,
+                                                           GlobalPolicy policy) {
+        switch (policy) {
+            case GlobalPolicy::EDF:
+                return std::make_unique<GEDF>(tasks, ncores);
+            case GlobalPolicy::RM:
+                return std::make_unique<GRM>(tasks, ncores);
+            case GlobalPolicy::DM:
+                return std::make_unique<GDM>(tasks, ncores);
+            case GlobalPolicy::EDZL:
+                return std::make_unique<EDZL>(tasks, ncores);
+            default:
+                throw std::runtime_error("[schedulers::make_global_scheduler] Invalid GlobalPolicy");
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#include "rtss/schedulers/partitioned.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "rtss/analysis/arith.h"
+
+namespace rtss::schedulers {
+    namespace {
+        size_t used_cores(const analysis::Partition &partition) {
+            return static_cast<size_t>(std::count_if(partition.tasks_on.begin(), partition.tasks_on.end(),
+                                                     [](const auto &on) { return !on.empty(); }));
+        }
+    }
+
+    // Passes the callbacks of one core's scheduler on to the observers of the
+    // PartitionedScheduler, with the task indices of the whole list and the core number.
+    // on_finish() is left to the PartitionedScheduler, which calls it once for all cores.
+    class PartitionedScheduler::CoreObserver : public SchedulerObserver {
+    public:
+        CoreObserver(PartitionedScheduler &parent, size_t core)
+            : _parent(parent), _core(core) {
+        }
+
+        void on_release(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) override {
+            std::lock_guard<std::mutex> lock(_parent._observer_m);
+            for (auto *o: _parent.observers) o->on_release(t, global(task_idx), abs_dl);
+        }
+
+        void on_dispatch(time::TimeDuration t, size_t task_idx, size_t) override {
+            std::lock_guard<std::mutex> lock(_parent._observer_m);
+            const size_t i = task_idx == IDLE_TASK ? IDLE_TASK : global(task_idx);
+            for (auto *o: _parent.observers) o->on_dispatch(t, i, _core);
+        }
+
+        void on_preempt(time::TimeDuration t, size_t task_idx) override {
+            std::lock_guard<std::mutex> lock(_parent._observer_m);
+            for (auto *o: _parent.observers) o->on_preempt(t, global(task_idx));
+        }
+
+        void on_complete(time::TimeDuration t, size_t task_idx, time::TimeDuration release,
+                         time::TimeDuration abs_dl) override {
+            std::lock_guard<std::mutex> lock(_parent._observer_m);
+            for (auto *o: _parent.observers) o->on_complete(t, global(task_idx), release, abs_dl);
+        }
+
+        void on_deadline_miss(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) override {
+            std::lock_guard<std::mutex> lock(_parent._observer_m);
+            for (auto *o: _parent.observers) o->on_deadline_miss(t, global(task_idx), abs_dl);
+        }
+
+    private:
+        PartitionedScheduler &_parent;
+        size_t _core;
+
+        [[nodiscard]] size_t global(size_t task_idx) const { return _parent._cores[_core].task_idx[task_idx]; }
+    };
+
+    PartitionedScheduler::PartitionedScheduler(std::vector<Task *> &tasks, const analysis::Partition &partition,
+                                               PreemptivePolicy policy, size_t nthreads)
+        : PreemptiveScheduler(tasks), _policy(policy), _cores(partition.tasks_on.size()),
+          _pool(nthreads > 0 ? nthreads : std::max<size_t>(1, used_cores(partition))) {
+        if (partition.core_of.size() != tasks.size()) {
+            throw std::runtime_error("[PartitionedScheduler::PartitionedScheduler] Partition does not match the task list");
+        }
+        if (partition.unassigned > 0) {
+            throw std::runtime_error("[PartitionedScheduler::PartitionedScheduler] Partition leaves tasks unassigned");
+        }
+        for (size_t c = 0; c < _cores.size(); c++) {
+            Core &core = _cores[c];
+            for (size_t i: partition.tasks_on[c]) {
+                if (partition.core_of.at(i) != c) {
+                    throw std::runtime_error("[PartitionedScheduler::PartitionedScheduler] Partition is inconsistent");
+                }
+                core.tasks.push_back(tasks[i]);
+                core.task_idx.push_back(i);
+            }
+            if (core.tasks.empty()) continue;
+            core.scheduler = make_preemptive_scheduler(core.tasks, policy);
+            core.observer = std::make_unique<CoreObserver>(*this, c);
+            core.scheduler->add_observer(core.observer.get());
+        }
+    }
+
+    PartitionedScheduler::~PartitionedScheduler() = default;
+
+    const SimulationStats &PartitionedScheduler::get_core_stats(size_t core) const {
+        return _cores.at(core).stats;
+    }
+
+    void PartitionedScheduler::run_scheduler(size_t nhyperperiods) {
+        stats = SimulationStats{};
+        stats.max_response_tm.assign(jobs.size(), time::ZERO_DURATION);
+        for (Core &core: _cores) core.stats = SimulationStats{};
+        this->sim_clock->reset();
+        if (nhyperperiods == 0 || jobs.empty()) return;
+
+        int64_t horizon_cnt;
+        if (!analysis::checked_mul(hyperperiod.count(), static_cast<int64_t>(nhyperperiods), horizon_cnt)) {
+            throw std::overflow_error("[PartitionedScheduler::run_scheduler] Simulation horizon overflows");
+        }
+        const bool is_virtual = this->sim_clock->is_virtual();
+        const auto *real = dynamic_cast<const time::RealClock *>(this->sim_clock.get());
+        const time::WaitMode wait_mode = real != nullptr ? real->wait_mode() : time::WaitMode::SLEEP;
+        for (Core &core: _cores) {
+            if (core.scheduler == nullptr) continue;
+            PreemptiveScheduler &sched = *core.scheduler;
+            // A core's hyperperiod divides the whole set's, so the horizon is a whole number of them.
+            const size_t core_nhyperperiods = static_cast<size_t>(horizon_cnt / sched.get_hyperperiod().count());
+            if (is_virtual) {
+                sched.set_clock(std::make_unique<time::VirtualClock>());
+            } else {
+                sched.set_clock(std::make_unique<time::RealClock>(wait_mode));
+            }
+            sched.set_verbose(verbose);
+            sched.set_logger(*logger);
+            _pool.submit([&core, core_nhyperperiods] {
+                core.scheduler->run_scheduler(core_nhyperperiods);
+                core.stats = core.scheduler->get_stats();
+            });
+        }
+        _pool.wait_idle();
+
+        for (const Core &core: _cores) {
+            stats.released_jobs += core.stats.released_jobs;
+            stats.completed_jobs += core.stats.completed_jobs;
+            stats.deadline_misses += core.stats.deadline_misses;
+            stats.preemptions += core.stats.preemptions;
+            for (size_t k = 0; k < core.stats.max_response_tm.size(); k++) {
+                stats.max_response_tm[core.task_idx[k]] = core.stats.max_response_tm[k];
+            }
+        }
+        const time::TimeDuration horizon(horizon_cnt);
+        this->sim_clock->advance_until(horizon);
+        for (auto *o: observers) o->on_finish(horizon);
+        flush_log();
+    }
+}
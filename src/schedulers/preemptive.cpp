@@ -0,0 +1,308 @@
+#include "rtss/schedulers/preemptive.h"
+
+#include <algorithm>
+
+#include "rtss/analysis/hyperperiod.h"
+#include "rtss/containers/indexed_heap.h"
+#include "rtss/containers/priority_bitmap.h"
+#include "rtss/schedulers/dynamic.h"
+
+namespace rtss::schedulers {
+    namespace {
+        constexpr size_t NO_TASK = SIZE_MAX;
+
+        class DeadlineQueue {
+        public:
+            explicit DeadlineQueue(const std::vector<JobState> &jobs)
+                : _jobs(jobs), _heap(jobs.size()) {
+            }
+
+            [[nodiscard]] bool empty() const noexcept { return _heap.empty(); }
+            [[nodiscard]] size_t top() const { return _heap.top(); }
+            void insert(size_t i) { _heap.push(i, _jobs[i].current().abs_dl); }
+            void remove(size_t i) { _heap.erase(i); }
+
+            void update(size_t) {
+            }
+
+        private:
+            const std::vector<JobState> &_jobs;
+            containers::IndexedHeap<time::TimeDuration> _heap;
+        };
+
+        // Laxity at time t is abs_dl - t - rem_tm; t is common to all jobs,
+        // so ordering on abs_dl - rem_tm gives the same order.
+        class LaxityQueue {
+        public:
+            explicit LaxityQueue(const std::vector<JobState> &jobs)
+                : _jobs(jobs), _heap(jobs.size()) {
+            }
+
+            [[nodiscard]] bool empty() const noexcept { return _heap.empty(); }
+            [[nodiscard]] size_t top() const { return _heap.top(); }
+            void insert(size_t i) { _heap.push(i, key(i)); }
+            void remove(size_t i) { _heap.erase(i); }
+            void update(size_t i) { _heap.update(i, key(i)); }
+
+        private:
+            const std::vector<JobState> &_jobs;
+            containers::IndexedHeap<time::TimeDuration> _heap;
+
+            [[nodiscard]] time::TimeDuration key(size_t i) const noexcept {
+                const Job &J = _jobs[i].current();
+                return J.abs_dl - J.rem_tm;
+            }
+        };
+
+        // One priority level per task, so the bitmap alone is the ready set.
+        class FixedPriorityQueue {
+        public:
+            explicit FixedPriorityQueue(const std::vector<size_t> &pri_level)
+                : _pri_level(pri_level), _task_at(pri_level.size()), _ready(pri_level.size()) {
+                for (size_t i = 0; i < pri_level.size(); i++) {
+                    _task_at[pri_level[i]] = i;
+                }
+            }
+
+            [[nodiscard]] bool empty() const noexcept { return _ready.empty(); }
+            [[nodiscard]] size_t top() const { return _task_at[_ready.first()]; }
+            void insert(size_t i) { _ready.set(_pri_level[i]); }
+            void remove(size_t i) { _ready.clear(_pri_level[i]); }
+
+            void update(size_t) {
+            }
+
+        private:
+            const std::vector<size_t> &_pri_level;
+            std::vector<size_t> _task_at; // priority level -> task index
+            containers::PriorityBitmap _ready;
+        };
+    }
+
+    PreemptiveScheduler::PreemptiveScheduler(std::vector<Task *> &tasks)
+        : RTScheduler(tasks), jobs(tasks.size()) {
+        time::TimeDuration last_arrival = time::ZERO_DURATION, aperiodic_wcet = time::ZERO_DURATION;
+        for (size_t i = 0; i < task_set.size(); i++) {
+            JobState &J = jobs[i];
+            J.phase = task_set.phase(i);
+            J.wcet = task_set.wcet(i);
+            if (task_set.is_periodic(i) && task_set.period(i) > time::ZERO_DURATION) {
+                J.periodic = true;
+                J.period = task_set.period(i);
+                J.rel_dl = task_set.rel_dl(i);
+            } else {
+                last_arrival = std::max(last_arrival, J.phase);
+                aperiodic_wcet += J.wcet;
+            }
+        }
+        hyperperiod = analysis::hyperperiod(task_set);
+        if (hyperperiod == time::ZERO_DURATION) {
+            // Aperiodic tasks only: run long enough for all of them to finish.
+            hyperperiod = last_arrival + aperiodic_wcet;
+        }
+    }
+
+    Job &PreemptiveScheduler::release_job(size_t i, time::TimeDuration release) {
+        JobState &J = jobs[i];
+        Job *job = job_pool.acquire(i, J.next_seq++, release, J.periodic ? release + J.rel_dl : NO_DEADLINE, J.wcet);
+        J.pending.push_back(job);
+        return *job;
+    }
+
+    void PreemptiveScheduler::retire_job(size_t i) noexcept {
+        job_pool.release(jobs[i].pending.pop_front());
+    }
+
+    void PreemptiveScheduler::clear_jobs() noexcept {
+        for (JobState &J: jobs) {
+            while (!J.pending.empty()) job_pool.release(J.pending.pop_front());
+            J.next_seq = 0;
+        }
+    }
+
+    template<typename ReadyQueue>
+    void PreemptiveScheduler::simulate(ReadyQueue &ready, size_t nhyperperiods) {
+        const size_t n = jobs.size();
+        stats = SimulationStats{};
+        stats.max_response_tm.assign(n, time::ZERO_DURATION);
+        this->sim_clock->reset();
+        clear_jobs();
+        if (nhyperperiods == 0 || n == 0) return;
+
+        int64_t horizon_cnt;
+        if (!analysis::checked_mul(hyperperiod.count(), static_cast<int64_t>(nhyperperiods), horizon_cnt)) {
+            throw std::overflow_error("[PreemptiveScheduler::simulate] Simulation horizon overflows");
+        }
+        const time::TimeDuration horizon(horizon_cnt);
+
+        // Release time of each task's next job.
+        containers::IndexedHeap<time::TimeDuration> releases(n);
+        for (size_t i = 0; i < n; i++) {
+            if (jobs[i].phase < horizon) {
+                releases.push(i, jobs[i].phase);
+            }
+        }
+
+        time::TimeDuration now = time::ZERO_DURATION;
+        size_t running = NO_TASK;
+        // Task the processor was last given to, IDLE_TASK included.
+        size_t dispatched = NO_TASK;
+        // A job completed since, so the next dispatch starts a new job even for the same task.
+        bool completed = false;
+        auto dispatch = [&](size_t i) {
+            if (i == dispatched && !completed) return;
+            dispatched = i;
+            completed = false;
+            for (auto *o: observers) o->on_dispatch(now, i, 0);
+        };
+        while (true) {
+            while (!releases.empty() && releases.key(releases.top()) <= now) {
+                size_t i = releases.top();
+                JobState &J = jobs[i];
+                time::TimeDuration release = releases.key(i);
+                stats.released_jobs++;
+                const bool was_active = J.active();
+                const Job &job = release_job(i, release);
+                if (!was_active) {
+                    ready.insert(i);
+                }
+                for (auto *o: observers) o->on_release(release, i, job.abs_dl);
+                if (J.periodic && release + J.period < horizon) {
+                    releases.update(i, release + J.period);
+                } else {
+                    releases.erase(i);
+                }
+            }
+            if (now >= horizon) break;
+
+            time::TimeDuration next_event = horizon;
+            if (!releases.empty()) {
+                next_event = std::min(next_event, releases.key(releases.top()));
+            }
+            if (ready.empty()) {
+                dispatch(IDLE_TASK);
+                log_event<logging::LogLevel::JOBS>(now, logging::EventKind::IDLE, 0, next_event);
+                this->sim_clock->advance_until(next_event);
+                now = next_event;
+                continue;
+            }
+
+            size_t i = ready.top();
+            Job &J = jobs[i].current();
+            if (running != NO_TASK && running != i) {
+                stats.preemptions++;
+                for (auto *o: observers) o->on_preempt(now, running);
+                log_event<logging::LogLevel::JOBS>(now, logging::EventKind::PREEMPT, this->tasks[running]->get_id(),
+                                                   time::ZERO_DURATION, this->tasks[i]->get_id());
+            }
+            running = i;
+            dispatch(i);
+            time::TimeDuration end = std::min(now + J.rem_tm, next_event);
+            log_event<logging::LogLevel::JOBS>(now, logging::EventKind::DISPATCH, this->tasks[i]->get_id(), end - now);
+            this->sim_clock->advance_until(end);
+            J.rem_tm -= end - now;
+            now = end;
+            if (J.rem_tm > time::ZERO_DURATION) {
+                ready.update(i);
+                continue;
+            }
+
+            // Job completed.
+            ready.remove(i);
+            running = NO_TASK;
+            completed = true;
+            stats.completed_jobs++;
+            stats.max_response_tm[i] = std::max(stats.max_response_tm[i], now - J.release);
+            for (auto *o: observers) o->on_complete(now, i, J.release, J.abs_dl);
+            if (now > J.abs_dl) {
+                stats.deadline_misses++;
+                for (auto *o: observers) o->on_deadline_miss(now, i, J.abs_dl);
+                log_event<logging::LogLevel::EVENTS>(now, logging::EventKind::DEADLINE_MISS, this->tasks[i]->get_id(),
+                                                     J.abs_dl);
+            }
+            retire_job(i);
+            if (jobs[i].active()) {
+                ready.insert(i);
+            }
+        }
+
+        // Unfinished jobs whose deadlines have already passed count as misses.
+        for (size_t i = 0; i < n; i++) {
+            for (const Job *job = jobs[i].pending.head(); job != nullptr; job = job->next) {
+                if (job->abs_dl <= horizon) {
+                    stats.deadline_misses++;
+                    for (auto *o: observers) o->on_deadline_miss(horizon, i, job->abs_dl);
+                }
+            }
+        }
+        clear_jobs();
+        for (auto *o: observers) o->on_finish(now);
+        flush_log();
+    }
+
+    void PreemptiveEDFScheduler::run_scheduler(size_t nhyperperiods) {
+        DeadlineQueue ready(this->jobs);
+        simulate(ready, nhyperperiods);
+    }
+
+    void PreemptiveLLFScheduler::run_scheduler(size_t nhyperperiods) {
+        LaxityQueue ready(this->jobs);
+        simulate(ready, nhyperperiods);
+    }
+
+    PreemptiveFixedPriorityScheduler::PreemptiveFixedPriorityScheduler(std::vector<Task *> &tasks,
+                                                                       const std::vector<size_t> &pri_idx)
+        : PreemptiveScheduler(tasks), pri_level(tasks.size(), SIZE_MAX) {
+        if (tasks.empty()) return;
+        if (pri_idx.size() != tasks.size()) {
+            throw std::runtime_error(
+                "[PreemptiveFixedPriorityScheduler::PreemptiveFixedPriorityScheduler] Priority order must list every task");
+        }
+        for (size_t level = 0; level < pri_idx.size(); level++) {
+            if (pri_idx[level] >= tasks.size() || pri_level[pri_idx[level]] != SIZE_MAX) {
+                throw std::runtime_error(
+                    "[PreemptiveFixedPriorityScheduler::PreemptiveFixedPriorityScheduler] Invalid priority order");
+            }
+            pri_level[pri_idx[level]] = level;
+        }
+    }
+
+    void PreemptiveFixedPriorityScheduler::run_scheduler(size_t nhyperperiods) {
+        FixedPriorityQueue ready(this->pri_level);
+        simulate(ready, nhyperperiods);
+    }
+
+    PreemptiveRMScheduler::PreemptiveRMScheduler(std::vector<Task *> &tasks)
+        : PreemptiveFixedPriorityScheduler(tasks, RateMonotonicScheduler(tasks).get_priority_order()) {
+    }
+
+    PreemptiveDMScheduler::PreemptiveDMScheduler(std::vector<Task *> &tasks)
+        : PreemptiveFixedPriorityScheduler(tasks, DeadlineMonotonicScheduler(tasks).get_priority_order()) {
+    }
+
+    const char *to_string(PreemptivePolicy policy) noexcept {
+        switch (policy) {
+            case PreemptivePolicy::EDF: return "EDF";
+            case PreemptivePolicy::LLF: return "LLF";
+            case PreemptivePolicy::RM: return "RM";
+            case PreemptivePolicy::DM: return "DM";
+            default: return "?";
+        }
+    }
+
+    std::unique_ptr<PreemptiveScheduler> make_preemptive_scheduler(std::vector<Task *> &tasks,
+                                                                   PreemptivePolicy policy) {
+        switch (policy) {
+            case PreemptivePolicy::EDF:
+                return std::make_unique<PEDF>(tasks);
+            case PreemptivePolicy::LLF:
+                return std::make_unique<PLLF>(tasks);
+            case PreemptivePolicy::RM:
+                return std::make_unique<PRM>(tasks);
+            case PreemptivePolicy::DM:
+                return std::make_unique<PDM>(tasks);
+            default:
+                throw std::runtime_error("[schedulers::make_preemptive_scheduler] Invalid PreemptivePolicy");
+        }
+    }
+}
@@ -1,6 +1,6 @@
 #include "rtss/schedulers/static.h"
 
-#include <iostream>
+#include "rtss/analysis/frames.h"
 
 namespace rtss::schedulers {
     void TableDrivenScheduler::run_scheduler(size_t nperiods) {
@@ -9,6 +9,11 @@ namespace rtss::schedulers {
         size_t period_counter = 0;
         int16_t task_id;
         se = this->task_tbl.get_current_entry();
+        dispatch_jitter.reset();
+        this->sim_clock->reset();
+        // Run time at which the table's time 0 falls in the current hyperperiod; the run starts
+        // with the current entry.
+        time::TimeDuration origin = -se.start_time;
         while (period_counter < nperiods) {
             while (se.task_id != static_cast<int16_t>(TaskID::RESET)) {
                 task_id = se.task_id;
@@ -18,30 +23,76 @@ namespace rtss::schedulers {
                     T = this->tasks[task_id - 1]; // task_id starts from 1 so that 0 and -1 can be reserved.
                 }
                 time::TimeDuration exec_time = this->task_tbl.get_next_entry().start_time - se.start_time;
-                T->run_task(exec_time);
-                std::cout << "T" << T->get_id() << " duration = " << rtss::time::toInt(exec_time) << " time::createTimeDurationMs" << std::endl;
+                wait_for_slot(origin + se.start_time);
+                log_event<logging::LogLevel::JOBS>(logging::EventKind::DISPATCH, T->get_id(), exec_time);
+                if (!observers.empty()) {
+                    const time::TimeDuration now = this->sim_clock->now();
+                    const size_t idx = task_id == static_cast<int16_t>(TaskID::IDLE) ? IDLE_TASK : task_id - 1;
+                    for (auto *o: observers) o->on_dispatch(now, idx, 0);
+                }
+                T->run_task(exec_time, *this->sim_clock);
                 this->task_tbl.increment_k();
                 se = this->task_tbl.get_current_entry();
             }
-            std::cout << "---- End of hyperperiod ----" << std::endl;
+            log_event<logging::LogLevel::EVENTS>(logging::EventKind::HYPERPERIOD_END);
             // End of the hyperperiod, reset the tasks.
             for (auto task: this->tasks) { task->reset(); }
+            // The RESET entry starts at the table length.
+            origin += se.start_time;
+            // Step over the RESET entry so the next hyperperiod starts from the first one.
+            this->task_tbl.increment_k();
+            se = this->task_tbl.get_current_entry();
             period_counter++;
         }
+        if (!observers.empty()) {
+            const time::TimeDuration now = this->sim_clock->now();
+            for (auto *o: observers) o->on_finish(now);
+        }
+        flush_log();
     }
 
     void CyclicExecutiveScheduler::run_scheduler(size_t nperiods) {
         size_t period_counter = 0;
+        const time::TimeDuration frame_tm = this->task_tbl.get_frame_tm_dur();
+        const time::TimeDuration table_tm = frame_tm * static_cast<int64_t>(this->task_tbl.size());
+        dispatch_jitter.reset();
+        this->sim_clock->reset();
+        // Run time of frame 0 in the current hyperperiod; the run starts with the current frame.
+        time::TimeDuration origin = -frame_tm * static_cast<int64_t>(this->task_tbl.get_k());
         while (period_counter < nperiods) {
-            std::cout << "---- Hyperperiod " << period_counter + 1 << " ----" << std::endl;
+            log_event<logging::LogLevel::EVENTS>(logging::EventKind::HYPERPERIOD_START,
+                                                 static_cast<int32_t>(period_counter + 1));
             do {
+                const time::TimeDuration frame_start = origin + frame_tm * static_cast<int64_t>(this->task_tbl.get_k());
+                wait_for_slot(frame_start);
                 const auto &frame = this->task_tbl.get_current_frame();
-                frame.run_frame(this->tasks);
+                frame.run_frame(this->tasks, *this->sim_clock, verbose ? this->logger : nullptr, observers);
+                // A frame shorter than the frame size leaves the processor idle until the next one.
+                if (!observers.empty() && this->sim_clock->now() < frame_start + frame_tm) {
+                    const time::TimeDuration now = this->sim_clock->now();
+                    for (auto *o: observers) o->on_dispatch(now, IDLE_TASK, 0);
+                }
                 this->task_tbl.increment_k();
             } while (this->task_tbl.get_k() != 0);
             // End of the hyperperiod, reset the tasks.
             for (auto task: this->tasks) { task->reset(); }
+            origin += table_tm;
             period_counter++;
         }
+        if (!observers.empty()) {
+            const time::TimeDuration now = this->sim_clock->now();
+            for (auto *o: observers) o->on_finish(now);
+        }
+        flush_log();
+    }
+
+    std::unique_ptr<CyclicExecutiveScheduler> make_cyclic_executive(std::vector<Task *> &tasks,
+                                                                    TaskTableBuilder &builder) {
+        const auto selection = analysis::select_frame_size(tasks);
+        if (!selection.found()) {
+            throw std::runtime_error("[schedulers::make_cyclic_executive] No frame size satisfies the frame constraints");
+        }
+        auto tbl = std::make_unique<TaskTable>(builder.build(StaticSchedulingMode::FRAME_BASED, selection.best, tasks));
+        return std::make_unique<CyclicExecutiveScheduler>(tasks, std::move(tbl));
     }
 }
@@ -0,0 +1,72 @@
+#include "rtss/schedulers/table_generator.h"
+
+#include <limits>
+#include <memory>
+
+#include "rtss/clock.h"
+#include "rtss/schedulers/observer.h"
+
+namespace rtss::schedulers {
+    namespace {
+        // Turns dispatch events into table entries.
+        // An entry is held back until time moves past it, so that zero-length
+        // segments are dropped and the segments around them are merged.
+        class TableRecorder : public SchedulerObserver {
+        public:
+            explicit TableRecorder(TaskTableBuilder &tbl_builder) : _tbl_builder(tbl_builder) {
+            }
+
+            void on_dispatch(time::TimeDuration t, size_t task_idx, size_t) override {
+                if (_pending && t > _pending_tm) {
+                    flush();
+                }
+                _pending = true;
+                _pending_tm = t;
+                _pending_id = task_idx == IDLE_TASK
+                                  ? static_cast<int16_t>(TaskID::IDLE)
+                                  : static_cast<int16_t>(task_idx + 1);
+            }
+
+            void on_finish(time::TimeDuration) override {
+                if (_pending) {
+                    flush();
+                }
+            }
+
+        private:
+            TaskTableBuilder &_tbl_builder;
+            bool _pending{false};
+            time::TimeDuration _pending_tm{time::ZERO_DURATION};
+            int16_t _pending_id{0};
+            bool _any{false};
+            int16_t _last_id{0};
+
+            void flush() {
+                if (!_any || _pending_id != _last_id) {
+                    _tbl_builder.add_entry(_pending_id, _pending_tm);
+                    _last_id = _pending_id;
+                    _any = true;
+                }
+                _pending = false;
+            }
+        };
+    }
+
+    SimulationStats generate_task_table(std::vector<Task *> &tasks, PreemptivePolicy policy,
+                                        TaskTableBuilder &tbl_builder) {
+        if (tasks.empty()) {
+            throw std::runtime_error("[schedulers::generate_task_table] Task list is empty");
+        }
+        if (tasks.size() > static_cast<size_t>(std::numeric_limits<int16_t>::max())) {
+            throw std::runtime_error("[schedulers::generate_task_table] Too many tasks for a schedule table");
+        }
+        auto scheduler = make_preemptive_scheduler(tasks, policy);
+        scheduler->set_clock(std::make_unique<time::VirtualClock>());
+        scheduler->set_verbose(false);
+        TableRecorder recorder(tbl_builder);
+        scheduler->add_observer(&recorder);
+        scheduler->run_scheduler(1);
+        tbl_builder.add_entry(static_cast<int16_t>(TaskID::RESET), scheduler->get_hyperperiod());
+        return scheduler->get_stats();
+    }
+}
@@ -0,0 +1,61 @@
+#include "rtss/task_store.h"
+
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace rtss {
+    namespace {
+        // Largest of the task types the store creates.
+        constexpr size_t TASK_SZ = sizeof(PeriodicTask) > sizeof(AperiodicTask)
+                                       ? sizeof(PeriodicTask)
+                                       : sizeof(AperiodicTask);
+    }
+
+    TaskStore::TaskStore(size_t ntasks) {
+        reserve(ntasks);
+    }
+
+    TaskStore::~TaskStore() {
+        release();
+    }
+
+    void TaskStore::reserve(size_t ntasks) {
+        if (!_tasks.empty()) {
+            throw std::runtime_error("[TaskStore::reserve] Store is not empty");
+        }
+        _arena.reset();
+        if (ntasks > 0) {
+            _arena.emplace(ntasks * TASK_SZ);
+            _tasks.reserve(ntasks);
+        } else {
+            _arena.emplace();
+        }
+    }
+
+    template<typename T, typename... Args>
+    T &TaskStore::emplace(Args &&... args) {
+        // Grow the list first, so that a task is never left out of it.
+        if (_tasks.size() == _tasks.capacity()) {
+            _tasks.reserve(_tasks.empty() ? 16 : 2 * _tasks.size());
+        }
+        T *task = ::new(_arena->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        _tasks.push_back(task);
+        return *task;
+    }
+
+    PeriodicTask &TaskStore::add_periodic(time::TimeDuration phase, time::TimeDuration period,
+                                          time::TimeDuration wcet, time::TimeDuration rel_dl) {
+        return emplace<PeriodicTask>(phase, period, wcet, rel_dl);
+    }
+
+    AperiodicTask &TaskStore::add_aperiodic(time::TimeDuration arrival, time::TimeDuration wcet) {
+        return emplace<AperiodicTask>(arrival, wcet);
+    }
+
+    void TaskStore::release() noexcept {
+        for (Task *T: _tasks) T->~Task();
+        _tasks.clear();
+        _arena->release();
+    }
+}
@@ -0,0 +1,65 @@
+#include "rtss/taskset.h"
+
+#include <stdexcept>
+
+namespace rtss {
+    TaskSet::TaskSet(const std::vector<Task *> &tasks) {
+        reserve(tasks.size());
+        for (auto *T: tasks) {
+            if (T == nullptr) {
+                throw std::runtime_error("[TaskSet::TaskSet] Task list contains a null task");
+            }
+            if (auto *P = dynamic_cast<PeriodicTask *>(T)) {
+                push(TaskKind::PERIODIC, T->get_id(), T->get_phase(), P->get_period(), T->get_wcet(),
+                     P->get_rel_dl(), T->get_rem_tm());
+            } else if (dynamic_cast<AperiodicTask *>(T) != nullptr) {
+                push(TaskKind::APERIODIC, T->get_id(), T->get_phase(), time::ZERO_DURATION, T->get_wcet(),
+                     time::ZERO_DURATION, T->get_rem_tm());
+            } else {
+                push(TaskKind::OTHER, T->get_id(), T->get_phase(), time::ZERO_DURATION, T->get_wcet(),
+                     time::ZERO_DURATION, T->get_rem_tm());
+            }
+        }
+    }
+
+    void TaskSet::reserve(size_t n) {
+        _kind.reserve(n);
+        _id.reserve(n);
+        _phase.reserve(n);
+        _period.reserve(n);
+        _wcet.reserve(n);
+        _rel_dl.reserve(n);
+        _rem_tm.reserve(n);
+    }
+
+    void TaskSet::clear() noexcept {
+        _kind.clear();
+        _id.clear();
+        _phase.clear();
+        _period.clear();
+        _wcet.clear();
+        _rel_dl.clear();
+        _rem_tm.clear();
+    }
+
+    size_t TaskSet::add_periodic(time::TimeDuration phase, time::TimeDuration period, time::TimeDuration wcet,
+                                 time::TimeDuration rel_dl, uint16_t id) {
+        return push(TaskKind::PERIODIC, id, phase, period, wcet, rel_dl, wcet);
+    }
+
+    size_t TaskSet::add_aperiodic(time::TimeDuration arrival, time::TimeDuration wcet, uint16_t id) {
+        return push(TaskKind::APERIODIC, id, arrival, time::ZERO_DURATION, wcet, time::ZERO_DURATION, wcet);
+    }
+
+    size_t TaskSet::push(TaskKind kind, uint16_t id, time::TimeDuration phase, time::TimeDuration period,
+                         time::TimeDuration wcet, time::TimeDuration rel_dl, time::TimeDuration rem_tm) {
+        _kind.push_back(kind);
+        _id.push_back(id);
+        _phase.push_back(phase);
+        _period.push_back(period);
+        _wcet.push_back(wcet);
+        _rel_dl.push_back(rel_dl);
+        _rem_tm.push_back(rem_tm);
+        return _kind.size() - 1;
+    }
+}
@@ -4,8 +4,7 @@
 #include "rtss/frame.h"
 
 namespace rtss {
-    FrameContainer *TaskTableBuilder::create_frames(time::TimeDuration frame_tm_dur,
-                                                    const std::vector<Task *> &tasks) {
+    std::vector<Frame> TaskTableBuilder::create_frames(time::TimeDuration frame_tm_dur) {
         this->_frame_tm_dur = frame_tm_dur;
         if (_schedule.empty()) {
             throw std::runtime_error("[TaskTableBuilder::create_frames] Schedule is empty");
@@ -54,6 +53,6 @@ namespace rtss {
             }
             rem_tm_dur = (cur_frame_dur + task_dur) % frame_tm_dur;
         }
-        return new FrameContainer(tasks, std::move(frames), frame_tm_dur);
+        return frames;
     }
 }
@@ -0,0 +1,252 @@
+#include "rtss/trace/chrome_trace.h"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+#include "rtss/job.h"
+
+namespace rtss::trace {
+    namespace {
+        constexpr int CPU_PID = 1;
+        constexpr int TASK_PID = 2;
+
+        // Tracks are numbered from 1: tid 0 is treated specially by some viewers.
+        int64_t core_tid(size_t core) noexcept { return static_cast<int64_t>(core) + 1; }
+
+        int64_t task_tid(size_t task_idx) noexcept { return static_cast<int64_t>(task_idx) + 1; }
+    }
+
+    ChromeTraceWriter::ChromeTraceWriter(const std::filesystem::path &path, const std::vector<Task *> &tasks)
+        : _path(path), _ofs(path, std::ios::binary) {
+        if (!_ofs) {
+            throw std::runtime_error("[ChromeTraceWriter::ChromeTraceWriter] Failed to open " + path.string());
+        }
+        _buf.reserve(BLOCK_SZ + 1024);
+        _task_ids.reserve(tasks.size());
+        for (size_t i = 0; i < tasks.size(); i++) {
+            if (tasks[i] == nullptr) {
+                throw std::runtime_error("[ChromeTraceWriter::ChromeTraceWriter] Task pointer is null");
+            }
+            // Tasks without an id are named after their position, like the schedule tables do.
+            _task_ids.push_back(tasks[i]->get_id() != 0 ? tasks[i]->get_id() : static_cast<int32_t>(i + 1));
+        }
+
+        append("{\"traceEvents\":[\n");
+        name_process(CPU_PID, "CPUs");
+        add_core(0);
+        name_process(TASK_PID, "Tasks");
+        for (size_t i = 0; i < _task_ids.size(); i++) {
+            name_track(TASK_PID, task_tid(i), "T", _task_ids[i]);
+        }
+    }
+
+    ChromeTraceWriter::~ChromeTraceWriter() {
+        if (_finished) return;
+        try {
+            time::TimeDuration last = time::ZERO_DURATION;
+            for (auto since: _running_since) last = std::max(last, since);
+            on_finish(last);
+        } catch (...) {
+            // Nothing sensible to do with a write error while unwinding.
+        }
+    }
+
+    void ChromeTraceWriter::on_release(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) {
+        check_open("[ChromeTraceWriter::on_release]");
+        const int64_t tid = task_tid(task_idx);
+        begin_event("i", TASK_PID, tid, "release", "release", t);
+        append(",\"s\":\"t\"");
+        end_event();
+        if (abs_dl != NO_DEADLINE) {
+            begin_event("i", TASK_PID, tid, "deadline", "deadline", abs_dl);
+            append(",\"s\":\"t\"");
+            end_event();
+        }
+    }
+
+    void ChromeTraceWriter::on_dispatch(time::TimeDuration t, size_t task_idx, size_t core) {
+        check_open("[ChromeTraceWriter::on_dispatch]");
+        add_core(core);
+        close_slice(core, t);
+        _running[core] = task_idx;
+        _running_since[core] = t;
+    }
+
+    void ChromeTraceWriter::on_preempt(time::TimeDuration t, size_t task_idx) {
+        check_open("[ChromeTraceWriter::on_preempt]");
+        begin_event("i", TASK_PID, task_tid(task_idx), "preempted", "preempt", t);
+        append(",\"s\":\"t\"");
+        end_event();
+    }
+
+    void ChromeTraceWriter::on_migrate(time::TimeDuration t, size_t task_idx, size_t from_core, size_t to_core) {
+        check_open("[ChromeTraceWriter::on_migrate]");
+        begin_event("i", TASK_PID, task_tid(task_idx), "migrated", "migrate", t);
+        append(",\"s\":\"t\",\"args\":{\"from\":");
+        append_int(static_cast<int64_t>(from_core));
+        append(",\"to\":");
+        append_int(static_cast<int64_t>(to_core));
+        append("}");
+        end_event();
+    }
+
+    void ChromeTraceWriter::on_complete(time::TimeDuration t, size_t task_idx, time::TimeDuration release,
+                                        time::TimeDuration abs_dl) {
+        check_open("[ChromeTraceWriter::on_complete]");
+        for (size_t core = 0; core < _running.size(); core++) {
+            if (_running[core] == task_idx) {
+                close_slice(core, t);
+                _running[core] = schedulers::IDLE_TASK;
+            }
+        }
+        begin_event("i", TASK_PID, task_tid(task_idx), "complete", "complete", t);
+        append(",\"s\":\"t\",\"args\":{\"response_us\":");
+        append_us(t - release);
+        if (abs_dl != NO_DEADLINE) {
+            // Negative for a job that completed late.
+            append(",\"slack_us\":");
+            append_us(abs_dl - t);
+        }
+        append("}");
+        end_event();
+    }
+
+    void ChromeTraceWriter::on_deadline_miss(time::TimeDuration t, size_t task_idx, time::TimeDuration abs_dl) {
+        check_open("[ChromeTraceWriter::on_deadline_miss]");
+        // Process-scoped, so misses stand out across all the task tracks.
+        begin_event("i", TASK_PID, task_tid(task_idx), "deadline miss", "miss", t);
+        append(",\"s\":\"p\",\"args\":{\"task\":\"T");
+        append_int(_task_ids.at(task_idx));
+        append("\",\"deadline_us\":");
+        append_us(abs_dl);
+        append("}");
+        end_event();
+    }
+
+    void ChromeTraceWriter::on_finish(time::TimeDuration t) {
+        check_open("[ChromeTraceWriter::on_finish]");
+        for (size_t core = 0; core < _running.size(); core++) {
+            close_slice(core, t);
+            _running[core] = schedulers::IDLE_TASK;
+        }
+        append("\n],\"displayTimeUnit\":\"ms\"}\n");
+        _finished = true;
+        write_block(true);
+        _ofs.close();
+        if (!_ofs) {
+            throw std::runtime_error("[ChromeTraceWriter::on_finish] Failed to write " + _path.string());
+        }
+    }
+
+    void ChromeTraceWriter::check_open(const char *fn) const {
+        if (_finished) {
+            throw std::runtime_error(std::string(fn) + " Trace is already finished");
+        }
+    }
+
+    void ChromeTraceWriter::name_process(int pid, const char *name) {
+        begin_event("M", pid, 0, "process_name", "__metadata", time::ZERO_DURATION);
+        append(",\"args\":{\"name\":\"");
+        append(name);
+        append("\"}");
+        end_event();
+    }
+
+    void ChromeTraceWriter::name_track(int pid, int64_t tid, const char *prefix, int64_t n) {
+        begin_event("M", pid, tid, "thread_name", "__metadata", time::ZERO_DURATION);
+        append(",\"args\":{\"name\":\"");
+        append(prefix);
+        append_int(n);
+        append("\"}");
+        end_event();
+        begin_event("M", pid, tid, "thread_sort_index", "__metadata", time::ZERO_DURATION);
+        append(",\"args\":{\"sort_index\":");
+        append_int(tid);
+        append("}");
+        end_event();
+    }
+
+    void ChromeTraceWriter::add_core(size_t core) {
+        while (_running.size() <= core) {
+            name_track(CPU_PID, core_tid(_running.size()), "CPU ", static_cast<int64_t>(_running.size()));
+            _running.push_back(schedulers::IDLE_TASK);
+            _running_since.push_back(time::ZERO_DURATION);
+        }
+    }
+
+    void ChromeTraceWriter::close_slice(size_t core, time::TimeDuration t) {
+        const size_t running = _running[core];
+        const time::TimeDuration since = _running_since[core];
+        if (running == schedulers::IDLE_TASK || t <= since) return;
+        const time::TimeDuration dur = t - since;
+        const int32_t id = _task_ids.at(running);
+        // Same slice on the core track and on the task's own track.
+        for (auto [pid, tid]: {std::pair<int, int64_t>{CPU_PID, core_tid(core)},
+                               std::pair<int, int64_t>{TASK_PID, task_tid(running)}}) {
+            begin_event("X", pid, tid, nullptr, "exec", since);
+            append(",\"name\":\"T");
+            append_int(id);
+            append("\",\"dur\":");
+            append_us(dur);
+            end_event();
+        }
+    }
+
+    void ChromeTraceWriter::begin_event(const char *ph, int pid, int64_t tid, const char *name, const char *cat,
+                                        time::TimeDuration ts) {
+        append(_nevents == 0 ? "{\"ph\":\"" : ",\n{\"ph\":\"");
+        append(ph);
+        append("\",\"pid\":");
+        append_int(pid);
+        append(",\"tid\":");
+        append_int(tid);
+        append(",\"ts\":");
+        append_us(ts);
+        append(",\"cat\":\"");
+        append(cat);
+        append("\"");
+        if (name != nullptr) {
+            append(",\"name\":\"");
+            append(name);
+            append("\"");
+        }
+    }
+
+    void ChromeTraceWriter::append(const char *s) { _buf += s; }
+
+    void ChromeTraceWriter::append_int(int64_t v) {
+        char tmp[24];
+        _buf.append(tmp, std::to_chars(tmp, tmp + sizeof(tmp), v).ptr);
+    }
+
+    void ChromeTraceWriter::append_us(time::TimeDuration d) {
+        int64_t ns = time::to_ns(d);
+        if (ns < 0) {
+            _buf += '-';
+            ns = -ns;
+        }
+        append_int(ns / 1000);
+        const auto frac = static_cast<int>(ns % 1000);
+        if (frac != 0) {
+            char tmp[4] = {'.', static_cast<char>('0' + frac / 100), static_cast<char>('0' + frac / 10 % 10),
+                           static_cast<char>('0' + frac % 10)};
+            _buf.append(tmp, sizeof(tmp));
+        }
+    }
+
+    void ChromeTraceWriter::end_event() {
+        _buf += '}';
+        _nevents++;
+        write_block(false);
+    }
+
+    void ChromeTraceWriter::write_block(bool force) {
+        if (!force && _buf.size() < BLOCK_SZ) return;
+        _ofs.write(_buf.data(), static_cast<std::streamsize>(_buf.size()));
+        _buf.clear();
+        if (!_ofs) {
+            throw std::runtime_error("[ChromeTraceWriter] Failed to write " + _path.string());
+        }
+    }
+}
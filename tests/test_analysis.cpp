@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "rtss/analysis/frames.h"
+#include "rtss/analysis/hyperperiod.h"
+#include "rtss/analysis/qpa.h"
+#include "rtss/analysis/rta.h"
+#include "rtss/schedulers/dynamic.h"
+
+using namespace rtss;
+
+namespace {
+    class TaskSetFixture : public ::testing::Test {
+    protected:
+        std::vector<std::unique_ptr<PeriodicTask> > owned;
+        std::vector<Task *> tasks;
+
+        void add(int period, int wcet, int rel_dl, int phase = 0) {
+            owned.push_back(std::make_unique<PeriodicTask>(
+                time::createTimeDurationMs(phase), time::createTimeDurationMs(period),
+                time::createTimeDurationMs(wcet), time::createTimeDurationMs(rel_dl)));
+            owned.back()->set_id(static_cast<short>(owned.size()));
+            tasks.push_back(owned.back().get());
+        }
+
+        int64_t ms(time::TimeDuration d) const { return time::toInt(d); }
+    };
+}
+
+// ---- Hyperperiod -----------------------------------------------------------
+
+TEST_F(TaskSetFixture, HyperperiodIsLcmOfPeriods) {
+    add(4, 1, 4);
+    add(6, 1, 6);
+    add(10, 1, 10);
+    EXPECT_EQ(ms(analysis::hyperperiod(tasks)), 60);
+}
+
+TEST_F(TaskSetFixture, HyperperiodOverflowThrows) {
+    // Distinct primes in ms: the LCM in nanoseconds does not fit into 64 bits.
+    for (int p: {1000003, 1000033, 1000037, 1000039}) {
+        add(p, 1, p);
+    }
+    EXPECT_THROW(analysis::hyperperiod(tasks), std::overflow_error);
+}
+
+// ---- Response time analysis ------------------------------------------------
+
+TEST_F(TaskSetFixture, RTAComputesRateMonotonicResponseTimes) {
+    add(13, 3, 13);
+    add(4, 1, 4);
+    add(6, 2, 6);
+    schedulers::RM rm(tasks);
+
+    auto result = analysis::response_time_analysis(tasks, rm.get_priority_order());
+    EXPECT_TRUE(result.schedulable);
+    EXPECT_EQ(ms(result.response_tm[1]), 1);
+    EXPECT_EQ(ms(result.response_tm[2]), 3);
+    EXPECT_EQ(ms(result.response_tm[0]), 10);
+}
+
+TEST_F(TaskSetFixture, RTAStopsAtFirstMiss) {
+    add(5, 2, 5);
+    add(7, 4, 7);
+    add(100, 1, 100);
+    schedulers::RM rm(tasks);
+
+    auto result = analysis::response_time_analysis(tasks, rm.get_priority_order());
+    EXPECT_FALSE(result.schedulable);
+    EXPECT_EQ(result.first_miss, 1u);
+    EXPECT_EQ(ms(result.response_tm[0]), 2);
+    EXPECT_EQ(result.response_tm[1], analysis::RTAResult::UNBOUNDED);
+    EXPECT_EQ(result.response_tm[2], analysis::RTAResult::UNBOUNDED);
+}
+
+TEST_F(TaskSetFixture, RTAAccountsForJitterAndBlocking) {
+    add(4, 1, 4);
+    add(6, 2, 6);
+    analysis::RTAParams params;
+    params.release_jitter = {time::createTimeDurationMs(1), time::createTimeDurationMs(1)};
+    params.blocking = {time::ZERO_DURATION, time::createTimeDurationMs(1)};
+
+    auto result = analysis::response_time_analysis(tasks, {0, 1}, params);
+    EXPECT_TRUE(result.schedulable);
+    // R_1 = J_1 + C_1 = 2; w_2 = B_2 + C_2 + ceil((w_2 + J_1) / T_1) C_1 = 5, R_2 = w_2 + J_2 = 6.
+    EXPECT_EQ(ms(result.response_tm[0]), 2);
+    EXPECT_EQ(ms(result.response_tm[1]), 6);
+}
+
+TEST_F(TaskSetFixture, RTAHandlesDeadlinesLongerThanPeriods) {
+    // Tindell's example: the worst case is the 5th job of the busy period.
+    add(70, 26, 70);
+    add(100, 62, 118);
+
+    auto result = analysis::response_time_analysis(tasks, {0, 1});
+    EXPECT_TRUE(result.schedulable);
+    EXPECT_EQ(ms(result.response_tm[1]), 118);
+}
+
+// ---- QPA (EDF) -------------------------------------------------------------
+
+TEST_F(TaskSetFixture, QPAAcceptsFeasibleConstrainedDeadlines) {
+    add(5, 2, 3);
+    add(7, 2, 4);
+    add(10, 1, 5);
+    auto result = analysis::qpa_edf(tasks);
+    EXPECT_TRUE(result.feasible);
+    EXPECT_TRUE(result.exact);
+    EXPECT_EQ(ms(analysis::demand_bound(tasks, time::createTimeDurationMs(8))), 7);
+}
+
+TEST_F(TaskSetFixture, QPARejectsDemandOverload) {
+    add(4, 2, 2);
+    add(6, 2, 3);
+    auto result = analysis::qpa_edf(tasks);
+    EXPECT_FALSE(result.feasible);
+    EXPECT_TRUE(result.exact);
+    EXPECT_GT(analysis::demand_bound(tasks, result.failure_point), result.failure_point);
+}
+
+TEST_F(TaskSetFixture, QPARejectsUtilisationAboveOne) {
+    add(10, 6, 10);
+    add(10, 5, 10);
+    EXPECT_FALSE(analysis::qpa_edf(tasks).feasible);
+}
+
+TEST_F(TaskSetFixture, QPAHandlesHugeHyperperiods) {
+    // Coprime periods of about 10^6 ms: the hyperperiod does not even fit into 64 bits.
+    for (int p: {1000003, 1000033, 1000037, 1000039, 1000081}) {
+        add(p, p / 20, p / 2);
+    }
+    auto result = analysis::qpa_edf(tasks);
+    EXPECT_TRUE(result.feasible);
+    EXPECT_LT(result.iterations, 100u);
+}
+
+TEST_F(TaskSetFixture, QPAIsOnlySufficientForPhasedTasks) {
+    add(4, 2, 2, 0);
+    add(6, 2, 3, 2);
+    auto result = analysis::qpa_edf(tasks);
+    EXPECT_FALSE(result.feasible);
+    EXPECT_FALSE(result.exact);
+}
+
+// ---- Frame size selection --------------------------------------------------
+
+TEST_F(TaskSetFixture, FrameSizeSatisfiesAllThreeConstraints) {
+    add(4, 1, 4);
+    add(5, 2, 5);
+    add(20, 1, 20);
+    add(20, 2, 20);
+    auto selection = analysis::select_frame_size(tasks);
+    EXPECT_EQ(ms(selection.hyperperiod), 20);
+    ASSERT_TRUE(selection.found());
+    ASSERT_EQ(selection.candidates.size(), 1u);
+    EXPECT_EQ(ms(selection.best), 2);
+}
+
+TEST_F(TaskSetFixture, FrameSizeCandidatesMatchBruteForce) {
+    add(15, 1, 14);
+    add(20, 2, 26);
+    add(22, 3, 22);
+    const int H = 660;
+
+    std::vector<int64_t> expected;
+    for (int f = 1; f <= H; f++) {
+        if (H % f != 0 || f < 3) continue;
+        bool ok = true;
+        for (auto &T: owned) {
+            int p = static_cast<int>(time::toInt(T->get_period()));
+            ok = ok && 2 * f - std::gcd(f, p) <= time::toInt(T->get_rel_dl());
+        }
+        if (ok) expected.push_back(f);
+    }
+
+    for (size_t nthreads: {1u, 4u}) {
+        auto selection = analysis::select_frame_size(tasks, analysis::fewest_frames, nthreads);
+        // Candidates are divisors of H in nanoseconds; keep the whole-millisecond ones.
+        std::vector<int64_t> whole_ms;
+        for (auto f: selection.candidates) {
+            if (f % time::createTimeDurationMs(1) == time::ZERO_DURATION) whole_ms.push_back(ms(f));
+        }
+        EXPECT_EQ(whole_ms, expected);
+        // Fewest frames = the largest frame.
+        EXPECT_EQ(selection.best, selection.candidates.back());
+    }
+}
+
+TEST_F(TaskSetFixture, FrameSizeUsesCustomCost) {
+    add(15, 1, 14);
+    add(20, 2, 26);
+    add(22, 3, 22);
+    auto most_frames = [](time::TimeDuration f, time::TimeDuration H) { return -analysis::fewest_frames(f, H); };
+    auto selection = analysis::select_frame_size(tasks, most_frames);
+    ASSERT_TRUE(selection.found());
+    EXPECT_EQ(selection.best, selection.candidates.front());
+}
@@ -0,0 +1,293 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "rtss/clock.h"
+#include "rtss/task.h"
+#include "rtss/tasktable.h"
+#include "rtss/schedulers/dynamic.h"
+#include "rtss/schedulers/static.h"
+
+using namespace rtss;
+
+namespace {
+    struct RunRecord {
+        uint16_t id;
+        int64_t start_ms;
+        int64_t exec_ms;
+    };
+
+    // Periodic task that records when (in scheduler time) it was run.
+    class RecordingTask : public PeriodicTask {
+    public:
+        RecordingTask(int phase, int period, int wcet, std::vector<RunRecord> &log)
+            : PeriodicTask(time::createTimeDurationMs(phase), time::createTimeDurationMs(period),
+                           time::createTimeDurationMs(wcet), time::createTimeDurationMs(period)),
+              _log(log) {
+        }
+
+        void run_task(time::TimeDuration exec_time, time::SimClock &clock) override {
+            _log.push_back({get_id(), time::toInt(clock.now()), time::toInt(exec_time)});
+            PeriodicTask::run_task(exec_time, clock);
+        }
+
+    private:
+        std::vector<RunRecord> &_log;
+    };
+}
+
+TEST(VirtualClock, AdvancesWithoutGoingBackwards) {
+    time::VirtualClock clock;
+    EXPECT_EQ(clock.now(), time::ZERO_DURATION);
+    clock.advance(time::createTimeDurationMs(5));
+    EXPECT_EQ(time::toInt(clock.now()), 5);
+    clock.advance_until(time::createTimeDurationMs(3));
+    EXPECT_EQ(time::toInt(clock.now()), 5);
+    clock.advance_until(time::createTimeDurationMs(12));
+    EXPECT_EQ(time::toInt(clock.now()), 12);
+    clock.reset();
+    EXPECT_EQ(clock.now(), time::ZERO_DURATION);
+    EXPECT_TRUE(clock.is_virtual());
+}
+
+TEST(VirtualClock, RateMonotonicRunsInPriorityOrder) {
+    std::vector<RunRecord> log;
+    RecordingTask t1(0, 5, 1, log), t2(0, 10, 2, log), t3(0, 4, 1, log);
+    t1.set_id(1);
+    t2.set_id(2);
+    t3.set_id(3);
+    std::vector<Task *> tasks = {&t1, &t2, &t3};
+
+    schedulers::RM rm(tasks);
+    rm.set_clock(std::make_unique<time::VirtualClock>());
+    rm.set_verbose(false);
+    rm.run_scheduler(1);
+
+    ASSERT_EQ(log.size(), 3u);
+    EXPECT_EQ(log[0].id, 3);
+    EXPECT_EQ(log[1].id, 1);
+    EXPECT_EQ(log[2].id, 2);
+    EXPECT_EQ(log[2].start_ms, 2);
+    EXPECT_EQ(time::toInt(rm.get_clock().now()), 4);
+}
+
+TEST(VirtualClock, IdlesUntilPhasedRelease) {
+    std::vector<RunRecord> log;
+    RecordingTask t1(10, 20, 3, log);
+    t1.set_id(1);
+    std::vector<Task *> tasks = {&t1};
+
+    schedulers::EDF edf(tasks);
+    edf.set_clock(std::make_unique<time::VirtualClock>());
+    edf.set_verbose(false);
+    edf.run_scheduler(1);
+
+    ASSERT_EQ(log.size(), 1u);
+    EXPECT_EQ(log[0].start_ms, 10);
+    EXPECT_EQ(time::toInt(edf.get_clock().now()), 13);
+}
+
+TEST(VirtualClock, TableDrivenSchedulerRepeatsHyperperiods) {
+    std::vector<RunRecord> log;
+    RecordingTask t1(0, 10, 2, log), t2(0, 10, 3, log);
+    t1.set_id(1);
+    t2.set_id(2);
+    std::vector<Task *> tasks = {&t1, &t2};
+
+    TaskTableBuilder builder;
+    builder.add_entry(1, time::createTimeDurationMs(0));
+    builder.add_entry(2, time::createTimeDurationMs(2));
+    builder.add_entry(static_cast<int16_t>(TaskID::IDLE), time::createTimeDurationMs(5));
+    builder.add_entry(static_cast<int16_t>(TaskID::RESET), time::createTimeDurationMs(10));
+    TaskTable tbl = builder.build(StaticSchedulingMode::TASK_BASED);
+
+    schedulers::TableDrivenScheduler sched(tasks, tbl);
+    sched.set_clock(std::make_unique<time::VirtualClock>());
+    sched.set_verbose(false);
+    sched.run_scheduler(2);
+
+    ASSERT_EQ(log.size(), 4u);
+    EXPECT_EQ(log[2].id, 1);
+    EXPECT_EQ(log[2].start_ms, 10);
+    EXPECT_EQ(log[3].id, 2);
+    EXPECT_EQ(log[3].exec_ms, 3);
+    EXPECT_EQ(time::toInt(sched.get_clock().now()), 20);
+    EXPECT_EQ(sched.get_dispatch_jitter().count(), 6u);
+    EXPECT_EQ(sched.get_dispatch_jitter().max(), 0);
+}
+
+TEST(VirtualClock, CyclicExecutiveReportsFrameJobsToObservers) {
+    struct DispatchLog : schedulers::SchedulerObserver {
+        std::vector<std::pair<int64_t, size_t>> dispatches;
+        int64_t finish_ms = -1;
+
+        void on_dispatch(time::TimeDuration t, size_t task_idx, size_t) override {
+            dispatches.emplace_back(time::toInt(t), task_idx);
+        }
+
+        void on_finish(time::TimeDuration t) override { finish_ms = time::toInt(t); }
+    };
+
+    std::vector<RunRecord> log;
+    RecordingTask t1(0, 10, 2, log), t2(0, 10, 3, log);
+    t1.set_id(1);
+    t2.set_id(2);
+    std::vector<Task *> tasks = {&t1, &t2};
+
+    TaskTableBuilder builder;
+    builder.add_entry(1, time::createTimeDurationMs(0));
+    builder.add_entry(2, time::createTimeDurationMs(2));
+    builder.add_entry(static_cast<int16_t>(TaskID::IDLE), time::createTimeDurationMs(5));
+    builder.add_entry(static_cast<int16_t>(TaskID::RESET), time::createTimeDurationMs(10));
+    TaskTable tbl = builder.build(StaticSchedulingMode::FRAME_BASED, time::createTimeDurationMs(5), tasks);
+
+    DispatchLog observer;
+    schedulers::CyclicExecutiveScheduler sched(tasks, tbl);
+    sched.add_observer(&observer);
+    sched.set_clock(std::make_unique<time::VirtualClock>());
+    sched.set_verbose(false);
+    sched.run_scheduler(2);
+
+    const std::vector<std::pair<int64_t, size_t>> expected = {
+        {0, 0}, {2, 1}, {5, schedulers::IDLE_TASK},
+        {10, 0}, {12, 1}, {15, schedulers::IDLE_TASK},
+    };
+    EXPECT_EQ(observer.dispatches, expected);
+    EXPECT_EQ(observer.finish_ms, 20);
+}
+
+TEST(VirtualClock, CyclicExecutiveFactoryPicksTheFrameSize) {
+    std::vector<RunRecord> log;
+    RecordingTask t1(0, 10, 2, log), t2(0, 10, 3, log);
+    t1.set_id(1);
+    t2.set_id(2);
+    std::vector<Task *> tasks = {&t1, &t2};
+
+    TaskTableBuilder builder;
+    builder.add_entry(1, time::createTimeDurationMs(0));
+    builder.add_entry(2, time::createTimeDurationMs(2));
+    builder.add_entry(static_cast<int16_t>(TaskID::IDLE), time::createTimeDurationMs(5));
+    builder.add_entry(static_cast<int16_t>(TaskID::RESET), time::createTimeDurationMs(10));
+
+    // Valid frame sizes are 5ms and 10ms; the default cost takes the one with the fewest frames.
+    auto sched = schedulers::make_cyclic_executive(tasks, builder);
+    EXPECT_EQ(sched->get_frame_size(), time::createTimeDurationMs(10));
+    sched->set_clock(std::make_unique<time::VirtualClock>());
+    sched->set_verbose(false);
+    sched->run_scheduler(2);
+
+    ASSERT_EQ(log.size(), 4u);
+    EXPECT_EQ(log[2].id, 1);
+    EXPECT_EQ(log[2].start_ms, 10);
+    EXPECT_EQ(log[3].start_ms, 12);
+    EXPECT_EQ(time::toInt(sched->get_clock().now()), 20);
+}
+
+TEST(VirtualClock, CyclicExecutiveFactoryThrowsWithoutAValidFrameSize) {
+    std::vector<RunRecord> log;
+    RecordingTask t1(0, 5, 4, log), t2(0, 7, 1, log);
+    t1.set_id(1);
+    t2.set_id(2);
+    std::vector<Task *> tasks = {&t1, &t2};
+
+    TaskTableBuilder builder;
+    builder.add_entry(1, time::createTimeDurationMs(0));
+    builder.add_entry(static_cast<int16_t>(TaskID::RESET), time::createTimeDurationMs(35));
+    EXPECT_THROW((void) schedulers::make_cyclic_executive(tasks, builder), std::runtime_error);
+}
+
+TEST(VirtualClock, CyclicExecutiveChecksTheGivenFrameSize) {
+    std::vector<RunRecord> log;
+    RecordingTask t1(0, 10, 2, log);
+    t1.set_id(1);
+    std::vector<Task *> tasks = {&t1};
+
+    TaskTableBuilder builder;
+    builder.add_entry(1, time::createTimeDurationMs(0));
+    builder.add_entry(static_cast<int16_t>(TaskID::IDLE), time::createTimeDurationMs(2));
+    builder.add_entry(static_cast<int16_t>(TaskID::RESET), time::createTimeDurationMs(10));
+    TaskTable tbl = builder.build(StaticSchedulingMode::FRAME_BASED, time::createTimeDurationMs(5), tasks);
+
+    EXPECT_NO_THROW(schedulers::CyclicExecutiveScheduler(tasks, tbl, 5));
+    EXPECT_THROW(schedulers::CyclicExecutiveScheduler(tasks, tbl, 10), std::runtime_error);
+}
+
+TEST(RealClock, WaitsDoNotAccumulateOvershoot) {
+    // 200 waits of 100us (one tick if that is longer): relative sleeps would add up every
+    // wake-up's overshoot, absolute ones end one overshoot after the nominal end.
+    const auto step = std::chrono::ceil<time::TimeDuration>(std::chrono::microseconds(100));
+    time::RealClock clock;
+    clock.reset();
+    for (int k = 0; k < 200; k++) {
+        clock.advance(step);
+    }
+    const time::TimeDuration late = clock.now() - 200 * step;
+    EXPECT_GE(late, time::ZERO_DURATION);
+    EXPECT_LT(late, std::chrono::milliseconds(2) + time::ticks(1));
+    EXPECT_FALSE(clock.is_virtual());
+}
+
+TEST(RealClock, HybridWaitWakesUpOnTime) {
+    EXPECT_GE(time::spin_guard(), std::chrono::microseconds(20));
+    EXPECT_LE(time::spin_guard(), std::chrono::milliseconds(2));
+
+    time::RealClock clock(time::WaitMode::HYBRID);
+    EXPECT_EQ(clock.wait_mode(), time::WaitMode::HYBRID);
+    clock.reset();
+    std::vector<time::TimeDuration> late;
+    for (int k = 1; k <= 51; k++) {
+        const time::TimeDuration t = std::chrono::ceil<time::TimeDuration>(std::chrono::microseconds(500)) * k;
+        clock.advance_until(t);
+        late.push_back(clock.now() - t);
+    }
+    std::sort(late.begin(), late.end());
+    EXPECT_GE(late.front(), time::ZERO_DURATION);
+    // The median only: a preempted wake-up is late whatever the wait does.
+    EXPECT_LT(late[late.size() / 2], std::chrono::microseconds(50));
+}
+
+TEST(RealClock, TableDrivenSlotsStayOnTheNominalTimeline) {
+    PeriodicTask t1(time::ZERO_DURATION, time::createTimeDurationMs(4), time::createTimeDurationMs(1),
+                    time::createTimeDurationMs(4));
+    t1.set_id(1);
+    std::vector<Task *> tasks = {&t1};
+
+    TaskTableBuilder builder;
+    builder.add_entry(1, time::createTimeDurationMs(0));
+    builder.add_entry(static_cast<int16_t>(TaskID::IDLE), time::createTimeDurationMs(1));
+    builder.add_entry(static_cast<int16_t>(TaskID::RESET), time::createTimeDurationMs(4));
+    TaskTable tbl = builder.build(StaticSchedulingMode::TASK_BASED);
+
+    schedulers::TableDrivenScheduler sched(tasks, tbl);
+    sched.set_verbose(false);
+    sched.run_scheduler(10);
+
+    const time::TimeDuration late = sched.get_clock().now() - time::createTimeDurationMs(40);
+    EXPECT_GE(late, time::ZERO_DURATION);
+    // now() is truncated to the tick, which may be a millisecond.
+    EXPECT_LT(late, std::chrono::milliseconds(2) + time::ticks(1));
+    const auto &jitter = sched.get_dispatch_jitter();
+    EXPECT_EQ(jitter.count(), 20u);
+    EXPECT_GE(jitter.min(), 0);
+}
+
+TEST(PriorityScheduler, OrdersPeriodicByPolicyKeyThenOthersByWcet) {
+    std::vector<RunRecord> log;
+    RecordingTask t1(0, 8, 1, log), t2(0, 4, 1, log), t3(0, 8, 2, log);
+    AperiodicTask a1(time::createTimeDurationMs(0), time::createTimeDurationMs(5));
+    AperiodicTask a2(time::createTimeDurationMs(0), time::createTimeDurationMs(3));
+    std::vector<Task *> tasks = {&a1, &t1, &a2, &t2, &t3};
+
+    schedulers::PriorityScheduler<schedulers::RMPolicy> rm(tasks);
+    const std::vector<size_t> expected = {3, 1, 4, 2, 0};
+    EXPECT_EQ(rm.get_priority_order(), expected);
+
+    // Same order through the runtime interface.
+    schedulers::RTScheduler &sched = rm;
+    sched.set_clock(std::make_unique<time::VirtualClock>());
+    sched.set_verbose(false);
+    sched.run_scheduler(1);
+    EXPECT_EQ(time::toInt(sched.get_clock().now()), 12);
+}
@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <vector>
 
 #include "rtss/frame.h"
 #include "rtss/task.h"
+#include "rtss/tasktable.h"
 
 namespace {
     using namespace rtss;
@@ -22,7 +24,6 @@ namespace {
             total_run_time += exec_tm;
         }
 
-    private:
         std::vector<time::TimeDuration> run_calls;
         time::TimeDuration total_run_time{time::ZERO_DURATION};
     };
@@ -111,7 +112,7 @@ TEST(FrameContainerTest, GetKthFrameThrowsOnInvalidIndex) {
 
     FrameContainer fc(std::move(tasks), std::move(frames), time::createTimeDurationMs(5));
 
-    EXPECT_THROW(fc.get_kth_frame(1), std::out_of_range);
+    EXPECT_THROW((void) fc.get_kth_frame(1), std::out_of_range);
 }
 
 TEST(FrameContainerTest, RunFrameThrowsOnInvalidIndex) {
@@ -181,3 +182,22 @@ TEST(FrameContainerTest, ToStringListsAllFramesAndJobs) {
     EXPECT_NE(s.find("{T1, 3ms}"), std::string::npos);
     EXPECT_NE(s.find("{T1, 2ms}"), std::string::npos);
 }
+
+TEST(FrameContainerTest, TableCopiesKeepTheFramesOfTheOriginal) {
+    TestTask t1(1), t2(2);
+    std::vector<Task *> tasks = {&t1, &t2};
+    TaskTableBuilder builder;
+    builder.add_entry(1, time::createTimeDurationMs(0));
+    builder.add_entry(2, time::createTimeDurationMs(3));
+    builder.add_entry(1, time::createTimeDurationMs(5));
+    auto tbl = std::make_unique<TaskTable>(
+        builder.build(StaticSchedulingMode::FRAME_BASED, time::createTimeDurationMs(5), tasks));
+    const FrameContainer *frames = tbl->get_frame_container();
+    ASSERT_NE(frames, nullptr);
+    const std::string text = frames->to_string();
+
+    TaskTable copy = *tbl;
+    tbl.reset();
+    ASSERT_EQ(copy.get_frame_container(), frames);
+    EXPECT_EQ(frames->to_string(), text);
+}
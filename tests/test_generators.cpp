@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include "rtss/analysis/hyperperiod.h"
+#include "rtss/generators/taskset_generator.h"
+#include "rtss/generators/utilisation.h"
+
+using namespace rtss;
+
+namespace {
+    double total_utilisation(const TaskSet &ts) {
+        double U = 0;
+        for (size_t i = 0; i < ts.size(); i++) {
+            if (ts.is_periodic(i)) {
+                U += static_cast<double>(ts.wcet(i).count()) / static_cast<double>(ts.period(i).count());
+            }
+        }
+        return U;
+    }
+}
+
+TEST(Generators, UtilisationVectorsSumToTotalWithinBounds) {
+    generators::Rng rng(1);
+    std::vector<double> u, table;
+    for (double total: {0.3, 1.0, 2.5, 7.9}) {
+        if (total < 3) {
+            generators::uunifast_discard(rng, 8, total, u);
+            EXPECT_NEAR(std::accumulate(u.begin(), u.end(), 0.0), total, 1e-9);
+            for (double v: u) EXPECT_LE(v, 1.0);
+        } else {
+            // Nearly every UUniFast draw has a value above 1 here; RandFixedSum does not need to discard.
+            EXPECT_THROW(generators::uunifast_discard(rng, 8, total, u), std::runtime_error);
+        }
+
+        generators::randfixedsum(rng, 8, total, u, table);
+        ASSERT_EQ(u.size(), 8u);
+        EXPECT_NEAR(std::accumulate(u.begin(), u.end(), 0.0), total, 1e-9);
+        for (double v: u) {
+            EXPECT_GE(v, 0.0);
+            EXPECT_LE(v, 1.0 + 1e-12);
+        }
+    }
+    EXPECT_THROW(generators::randfixedsum(rng, 4, 4.5, u, table), std::runtime_error);
+}
+
+TEST(Generators, SameSeedGivesSameTaskSet) {
+    generators::GeneratorParams params;
+    params.nperiodic = 50;
+    params.utilisation = 0.9;
+    params.dl_ratio_min = 0.5;
+    params.random_phases = true;
+    params.naperiodic = 5;
+    TaskSet a, b, c;
+    generators::TaskSetGenerator(42).generate(params, a);
+    generators::TaskSetGenerator(42).generate(params, b);
+    generators::TaskSetGenerator(43).generate(params, c);
+    ASSERT_EQ(a.size(), 55u);
+    EXPECT_EQ(a.periods(), b.periods());
+    EXPECT_EQ(a.wcets(), b.wcets());
+    EXPECT_EQ(a.rel_dls(), b.rel_dls());
+    EXPECT_EQ(a.phases(), b.phases());
+    EXPECT_NE(a.wcets(), c.wcets());
+
+    // Each WCET is rounded to a whole tick, which is off by up to 1 / period in utilisation.
+    const double tick_tol = static_cast<double>(params.nperiodic) /
+                            static_cast<double>(time::createTimeDurationMs(params.period_min_ms).count());
+    EXPECT_NEAR(total_utilisation(a), 0.9, tick_tol);
+    for (size_t i = 0; i < 50; i++) {
+        EXPECT_GE(a.period(i), time::createTimeDurationMs(10));
+        EXPECT_LE(a.period(i), time::createTimeDurationMs(1000));
+        EXPECT_GE(a.rel_dl(i), a.wcet(i));
+        EXPECT_LE(a.rel_dl(i), a.period(i));
+        EXPECT_LT(a.phase(i), a.period(i));
+    }
+    EXPECT_EQ(a.kind(54), TaskKind::APERIODIC);
+}
+
+TEST(Generators, PeriodDistributionsBoundTheHyperperiod) {
+    generators::TaskSetGenerator gen(7);
+    generators::GeneratorParams params;
+    params.nperiodic = 40;
+    params.method = generators::UtilisationMethod::RANDFIXEDSUM;
+    params.periods = generators::PeriodDistribution::HARMONIC;
+    params.period_min_ms = 5;
+    params.period_max_ms = 700;
+    TaskSet ts;
+    gen.generate(params, ts);
+    // Harmonic periods are 5 * 2^k <= 700, so the hyperperiod is at most 640ms.
+    EXPECT_LE(analysis::hyperperiod(ts), time::createTimeDurationMs(640));
+
+    params.periods = generators::PeriodDistribution::BOUNDED_HYPERPERIOD;
+    params.hyperperiod_bound_ms = 3600;
+    gen.generate(params, ts);
+    EXPECT_EQ(time::createTimeDurationMs(3600) % analysis::hyperperiod(ts), time::ZERO_DURATION);
+
+    params.period_min_ms = 3601;
+    params.period_max_ms = 4000;
+    EXPECT_THROW(gen.generate(params, ts), std::runtime_error);
+}
+
+TEST(Generators, MakeTasksBuildsContiguousTaskObjects) {
+    generators::GeneratorParams params;
+    params.nperiodic = 6;
+    params.naperiodic = 2;
+    TaskSet ts;
+    generators::TaskSetGenerator(3).generate(params, ts);
+    generators::TaskStorage storage;
+    generators::make_tasks(ts, storage);
+    ASSERT_EQ(storage.tasks.size(), 8u);
+    EXPECT_EQ(storage.periodic.size(), 6u);
+    EXPECT_EQ(storage.tasks[0], &storage.periodic[0]);
+    EXPECT_EQ(storage.tasks[7], &storage.aperiodic[1]);
+    EXPECT_EQ(storage.tasks[7]->get_id(), 8);
+    EXPECT_EQ(storage.periodic[2].get_rel_dl(), ts.rel_dl(2));
+
+    TaskSet round_trip(storage.tasks);
+    EXPECT_EQ(round_trip.wcets(), ts.wcets());
+
+    // Ids are copied from the set, including ones beyond the range of short.
+    TaskSet custom;
+    custom.add_periodic(time::ZERO_DURATION, ts.period(0), ts.wcet(0), ts.rel_dl(0), 40000);
+    custom.add_aperiodic(time::ZERO_DURATION, ts.wcet(0), 7);
+    generators::make_tasks(custom, storage);
+    EXPECT_EQ(storage.tasks[0]->get_id(), 40000);
+    EXPECT_EQ(storage.tasks[1]->get_id(), 7);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "rtss/clock.h"
+#include "rtss/metrics/recorder.h"
+#include "rtss/schedulers/global.h"
+
+#include "test_util.h"
+
+using namespace rtss;
+using namespace test_util;
+
+TEST(GlobalScheduler, EDZLAvoidsTheMissOfGlobalEDF) {
+    // Dhall's effect on two cores: the light tasks take both cores first and the heavy task
+    // misses under G-EDF. EDZL runs it from the moment its laxity reaches zero (t = 1).
+    auto T1 = make_periodic(0, 10, 2, 10, 1);
+    auto T2 = make_periodic(0, 10, 2, 10, 2);
+    auto T3 = make_periodic(0, 10, 9, 10, 3);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get()};
+
+    schedulers::GEDF gedf(tasks, 2);
+    const auto &edf_stats = simulate(gedf, 1);
+    EXPECT_EQ(edf_stats.deadline_misses, 1u);
+    // T3 still has 1 ms left at the end of the hyperperiod.
+    EXPECT_EQ(edf_stats.completed_jobs, 2u);
+
+    schedulers::EDZL edzl(tasks, 2);
+    const auto &stats = simulate(edzl, 3);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+    EXPECT_EQ(stats.completed_jobs, 9u);
+    // Each hyperperiod T3 preempts T2 on core 1 and T2 resumes on core 0 when T1 is done.
+    EXPECT_EQ(stats.preemptions, 3u);
+    EXPECT_EQ(stats.migrations, 3u);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[1]), 3);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[2]), 10);
+}
+
+TEST(GlobalScheduler, OneCoreMatchesTheUniprocessorSimulation) {
+    std::mt19937 rng(5);
+    const int periods[] = {4, 5, 6, 8, 10, 12, 15, 20};
+    for (int round = 0; round < 20; round++) {
+        std::vector<std::unique_ptr<PeriodicTask> > owned;
+        std::vector<Task *> tasks;
+        for (int k = 0; k < 5; k++) {
+            int p = periods[rng() % 8];
+            int c = 1 + static_cast<int>(rng() % (p / 3));
+            owned.push_back(make_periodic(static_cast<int>(rng() % 3), p, c, p - static_cast<int>(rng() % 2),
+                                          static_cast<short>(k + 1)));
+            tasks.push_back(owned.back().get());
+        }
+        const std::pair<schedulers::GlobalPolicy, schedulers::PreemptivePolicy> pairs[] = {
+            {schedulers::GlobalPolicy::EDF, schedulers::PreemptivePolicy::EDF},
+            {schedulers::GlobalPolicy::RM, schedulers::PreemptivePolicy::RM},
+            {schedulers::GlobalPolicy::DM, schedulers::PreemptivePolicy::DM},
+        };
+        for (auto [gp, pp]: pairs) {
+            auto global = schedulers::make_global_scheduler(tasks, 1, gp);
+            auto uni = schedulers::make_preemptive_scheduler(tasks, pp);
+            const auto &g = simulate(*global, 2);
+            const auto &u = simulate(*uni, 2);
+            EXPECT_EQ(g.released_jobs, u.released_jobs) << schedulers::to_string(gp);
+            EXPECT_EQ(g.completed_jobs, u.completed_jobs) << schedulers::to_string(gp);
+            EXPECT_EQ(g.deadline_misses, u.deadline_misses) << schedulers::to_string(gp);
+            EXPECT_EQ(g.preemptions, u.preemptions) << schedulers::to_string(gp);
+            EXPECT_EQ(g.max_response_tm, u.max_response_tm) << schedulers::to_string(gp);
+            EXPECT_EQ(g.migrations, 0u);
+        }
+    }
+}
+
+TEST(GlobalScheduler, ObserversSeeEveryCore) {
+    auto T1 = make_periodic(0, 4, 3, 4, 1);
+    auto T2 = make_periodic(0, 6, 4, 6, 2);
+    auto T3 = make_periodic(0, 12, 6, 12, 3);
+    auto T4 = make_periodic(1, 12, 5, 12, 4);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get(), T4.get()};
+
+    schedulers::GRM grm(tasks, 3);
+    metrics::MetricsRecorder recorder(tasks);
+    grm.add_observer(&recorder);
+    const auto &stats = simulate(grm, 2);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+    EXPECT_EQ(recorder.ncores(), 3u);
+    EXPECT_EQ(recorder.total().migrations, stats.migrations);
+    EXPECT_EQ(recorder.total().preemptions, stats.preemptions);
+    // (3 * 3 + 4 * 2 + 6 + 5) ms of work per 12 ms hyperperiod on 3 cores.
+    EXPECT_EQ(recorder.busy_time(), time::createTimeDurationMs(2 * 28));
+    EXPECT_NEAR(recorder.utilisation(), 28.0 / 36.0, 1e-12);
+}
+
+TEST(GlobalScheduler, RejectsZeroCores) {
+    auto T1 = make_periodic(0, 4, 1, 4, 1);
+    std::vector<Task *> tasks = {T1.get()};
+    EXPECT_THROW(schedulers::GEDF(tasks, 0), std::runtime_error);
+}
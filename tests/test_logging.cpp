@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rtss/clock.h"
+#include "rtss/containers/spsc_ring.h"
+#include "rtss/logging/event_log.h"
+#include "rtss/schedulers/preemptive.h"
+#include "rtss/task.h"
+
+using namespace rtss;
+
+namespace {
+    // Keeps every record it receives.
+    class CollectingSink : public logging::LogSink {
+    public:
+        explicit CollectingSink(std::vector<logging::LogRecord> &out) : _out(out) {
+        }
+
+        void write(const logging::LogRecord *records, size_t n) override {
+            _out.insert(_out.end(), records, records + n);
+        }
+
+    private:
+        std::vector<logging::LogRecord> &_out;
+    };
+}
+
+TEST(SpscRing, KeepsOrderAcrossWrapAround) {
+    containers::SpscRing<int> ring(3);
+    EXPECT_EQ(ring.capacity(), 4u);
+    int out[4];
+    int next_in = 0, next_out = 0;
+    for (int round = 0; round < 10; round++) {
+        while (ring.try_push(next_in)) next_in++;
+        EXPECT_EQ(next_in - next_out, 4);
+        size_t n = ring.pop(out, 3);
+        ASSERT_EQ(n, 3u);
+        for (size_t k = 0; k < n; k++) EXPECT_EQ(out[k], next_out++);
+    }
+    EXPECT_EQ(ring.pop(out, 4), 1u);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(EventLogger, SchedulerWritesTextThroughItsLogger) {
+    std::ostringstream oss;
+    logging::EventLogger logger;
+    logger.add_sink(std::make_unique<logging::TextSink>(oss));
+
+    PeriodicTask t1(time::ZERO_DURATION, time::createTimeDurationMs(4), time::createTimeDurationMs(1),
+                    time::createTimeDurationMs(4));
+    PeriodicTask t2(time::ZERO_DURATION, time::createTimeDurationMs(8), time::createTimeDurationMs(4),
+                    time::createTimeDurationMs(8));
+    t1.set_id(1);
+    t2.set_id(2);
+    std::vector<Task *> tasks = {&t1, &t2};
+    schedulers::PreemptiveRMScheduler sched(tasks);
+    sched.set_clock(std::make_unique<time::VirtualClock>());
+    sched.set_logger(logger);
+    sched.run_scheduler(1);
+
+    // run_scheduler() flushes before returning.
+    EXPECT_EQ(oss.str(),
+              "[0ms] Running T1 for 1ms\n"
+              "[1ms] Running T2 for 3ms\n"
+              "[4ms] T2 preempted by T1\n"
+              "[4ms] Running T1 for 1ms\n"
+              "[5ms] Running T2 for 1ms\n"
+              "[6ms] Idle until 8ms\n");
+}
+
+TEST(EventLogger, FiltersByLevelAndKeepsPerThreadOrder) {
+    std::vector<logging::LogRecord> records;
+    logging::EventLogger logger(16);
+    logger.add_sink(std::make_unique<CollectingSink>(records));
+    logger.set_level(logging::LogLevel::EVENTS);
+    EXPECT_TRUE(logger.enabled(logging::LogLevel::EVENTS));
+    EXPECT_FALSE(logger.enabled(logging::LogLevel::JOBS));
+    logger.set_level(logging::LogLevel::DEBUG);
+
+    // More records than the rings hold, so producers also wait for the drain thread.
+    constexpr int NTHREADS = 4, NRECORDS = 1000;
+    std::vector<std::thread> threads;
+    for (int th = 0; th < NTHREADS; th++) {
+        threads.emplace_back([&logger, th] {
+            for (int k = 0; k < NRECORDS; k++) {
+                logger.log({k, 0, th, 0, logging::EventKind::DISPATCH});
+            }
+        });
+    }
+    for (auto &t: threads) t.join();
+    logger.flush();
+
+    ASSERT_EQ(records.size(), static_cast<size_t>(NTHREADS * NRECORDS));
+    std::vector<int64_t> next(NTHREADS, 0);
+    for (const auto &r: records) {
+        EXPECT_EQ(r.time_ns, next[r.id]++);
+    }
+    EXPECT_EQ(logger.dropped(), 0u);
+}
+
+TEST(EventLogger, DropsInsteadOfWaitingWhenAsked) {
+    std::vector<logging::LogRecord> records;
+    logging::EventLogger logger(4, true);
+    logger.add_sink(std::make_unique<CollectingSink>(records));
+    for (int k = 0; k < 100000; k++) {
+        logger.log({k, 0, 0, 0, logging::EventKind::DISPATCH});
+    }
+    logger.flush();
+    EXPECT_EQ(records.size() + logger.dropped(), 100000u);
+}
+
+TEST(BinarySink, WritesWholeRecordsWithZeroedPadding) {
+    const auto path = std::filesystem::temp_directory_path() / "rtss_test_log.bin";
+    logging::LogRecord records[2];
+    // Garbage in the storage a record is built in must not reach the file.
+    std::memset(static_cast<void *>(records), 0xAB, sizeof(records));
+    new(&records[0]) logging::LogRecord{1000, 2000, 3, 0, logging::EventKind::DISPATCH};
+    new(&records[1]) logging::LogRecord{};
+    {
+        logging::BinarySink sink(path);
+        sink.write(records, 2);
+    }
+    std::ifstream ifs(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    std::filesystem::remove(path);
+    ASSERT_EQ(bytes.size(), 2 * sizeof(logging::LogRecord));
+    for (size_t r = 0; r < 2; r++) {
+        for (size_t k = offsetof(logging::LogRecord, kind) + 1; k < sizeof(logging::LogRecord); k++) {
+            EXPECT_EQ(bytes[r * sizeof(logging::LogRecord) + k], '\0') << "record " << r << ", byte " << k;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "rtss/clock.h"
+#include "rtss/metrics/histogram.h"
+#include "rtss/metrics/recorder.h"
+#include "rtss/schedulers/preemptive.h"
+#include "rtss/task.h"
+
+using namespace rtss;
+
+namespace {
+    time::TimeDuration ms(int64_t v) { return time::createTimeDurationMs(v); }
+}
+
+TEST(HdrHistogram, PercentilesKeepTheRequestedPrecision) {
+    metrics::HdrHistogram h(2);
+    std::vector<int64_t> values;
+    uint64_t x = 12345;
+    for (int k = 0; k < 100000; k++) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        values.push_back(static_cast<int64_t>(x >> 20) % 5'000'000'000);
+        h.record(values.back());
+    }
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(h.count(), values.size());
+    EXPECT_EQ(h.min(), values.front());
+    EXPECT_EQ(h.max(), values.back());
+    for (double p: {1.0, 25.0, 50.0, 90.0, 99.0, 99.9}) {
+        int64_t exact = values[static_cast<size_t>(p / 100.0 * values.size()) - 1];
+        int64_t approx = h.value_at_percentile(p);
+        EXPECT_LE(std::llabs(approx - exact), exact / 100 + 1) << "p" << p;
+    }
+    EXPECT_EQ(h.value_at_percentile(100), values.back());
+}
+
+TEST(HdrHistogram, SmallValuesAreExactAndNegativesSortFirst) {
+    metrics::HdrHistogram h(2);
+    for (int64_t v: {-200, -5, 0, 7, 100}) h.record(v);
+    EXPECT_EQ(h.value_at_percentile(20), -200);
+    EXPECT_EQ(h.value_at_percentile(40), -5);
+    EXPECT_EQ(h.value_at_percentile(60), 0);
+    EXPECT_EQ(h.value_at_percentile(80), 7);
+    EXPECT_EQ(h.value_at_percentile(100), 100);
+    EXPECT_DOUBLE_EQ(h.mean(), (-200 - 5 + 7 + 100) / 5.0);
+
+    metrics::HdrHistogram other(2);
+    other.record(1'000'000);
+    h.merge(other);
+    EXPECT_EQ(h.count(), 6u);
+    EXPECT_EQ(h.max(), 1'000'000);
+    EXPECT_THROW(h.merge(metrics::HdrHistogram(3)), std::runtime_error);
+    EXPECT_THROW(metrics::HdrHistogram(0), std::runtime_error);
+}
+
+TEST(MetricsRecorder, RecordsResponseTimesAndJitterOfARun) {
+    // RM: T1 runs at 0, 4 and 8; T2's first job waits for T1 (starts at 1), its second does not (starts at 6).
+    PeriodicTask t1(time::ZERO_DURATION, ms(4), ms(1), ms(4));
+    PeriodicTask t2(time::ZERO_DURATION, ms(6), ms(2), ms(6));
+    t1.set_id(1);
+    t2.set_id(2);
+    std::vector<Task *> tasks = {&t1, &t2};
+    schedulers::PRM sched(tasks);
+    sched.set_clock(std::make_unique<time::VirtualClock>());
+    sched.set_verbose(false);
+    metrics::MetricsRecorder recorder(tasks);
+    sched.add_observer(&recorder);
+    sched.run_scheduler(1);
+
+    const metrics::TaskMetrics &m1 = recorder.task(0), &m2 = recorder.task(1);
+    EXPECT_EQ(m1.released_jobs, 3u);
+    EXPECT_EQ(m1.completed_jobs, 3u);
+    EXPECT_EQ(m1.response_tm.max(), time::to_ns(ms(1)));
+    EXPECT_EQ(m1.start_jitter.max(), 0);
+    EXPECT_EQ(m1.exec_tm, ms(3));
+
+    EXPECT_EQ(m2.completed_jobs, 2u);
+    EXPECT_EQ(m2.response_tm.min(), time::to_ns(ms(2)));
+    EXPECT_EQ(m2.response_tm.max(), time::to_ns(ms(3)));
+    EXPECT_EQ(m2.start_latency.max() - m2.start_latency.min(), time::to_ns(ms(1)));
+    EXPECT_EQ(m2.start_jitter.count(), 1u);
+    EXPECT_EQ(m2.start_jitter.max(), time::to_ns(ms(1)));
+    EXPECT_EQ(m2.finish_jitter.max(), time::to_ns(ms(1)));
+    EXPECT_EQ(m2.lateness.max(), -time::to_ns(ms(3)));
+    EXPECT_EQ(m2.deadline_misses, 0u);
+
+    EXPECT_EQ(recorder.busy_time(), ms(7));
+    EXPECT_EQ(recorder.elapsed(), ms(12));
+    EXPECT_NEAR(recorder.utilisation(), 7.0 / 12.0, 1e-12);
+    EXPECT_NE(recorder.to_string().find("T2"), std::string::npos);
+
+    // A second run accumulates, reset() starts over.
+    sched.run_scheduler(1);
+    EXPECT_EQ(recorder.task(1).completed_jobs, 4u);
+    EXPECT_EQ(recorder.elapsed(), ms(24));
+    recorder.reset();
+    EXPECT_EQ(recorder.total().completed_jobs, 0u);
+    EXPECT_EQ(recorder.utilisation(), 0.0);
+}
+
+TEST(MetricsRecorder, AgreesWithSchedulerStatsUnderOverload) {
+    // U = 1.25: T2 misses deadlines, overruns its period and gets preempted.
+    PeriodicTask t1(time::ZERO_DURATION, ms(4), ms(3), ms(4));
+    PeriodicTask t2(time::ZERO_DURATION, ms(8), ms(4), ms(8));
+    std::vector<Task *> tasks = {&t1, &t2};
+    schedulers::PEDF sched(tasks);
+    sched.set_clock(std::make_unique<time::VirtualClock>());
+    sched.set_verbose(false);
+    metrics::MetricsRecorder recorder(tasks);
+    sched.add_observer(&recorder);
+    sched.run_scheduler(4);
+
+    const schedulers::SimulationStats &stats = sched.get_stats();
+    const metrics::TaskMetrics all = recorder.total();
+    EXPECT_GT(stats.deadline_misses, 0u);
+    EXPECT_EQ(all.released_jobs, stats.released_jobs);
+    EXPECT_EQ(all.completed_jobs, stats.completed_jobs);
+    EXPECT_EQ(all.deadline_misses, stats.deadline_misses);
+    EXPECT_EQ(all.preemptions, stats.preemptions);
+    EXPECT_EQ(all.start_latency.count(), stats.completed_jobs);
+    for (size_t i = 0; i < tasks.size(); i++) {
+        EXPECT_EQ(recorder.task(i).response_tm.max(), time::to_ns(stats.max_response_tm[i]));
+    }
+    EXPECT_GT(recorder.total().lateness.max(), 0);
+    EXPECT_DOUBLE_EQ(recorder.utilisation(), 1.0);
+}
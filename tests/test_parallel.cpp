@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "rtss/parallel/batch.h"
+#include "rtss/parallel/thread_pool.h"
+
+using namespace rtss;
+
+TEST(ThreadPool, RunsAllJobsIncludingNestedOnes) {
+    parallel::ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    std::atomic<int> count{0};
+    for (int i = 0; i < 100; i++) {
+        pool.submit([&pool, &count] {
+            count++;
+            // Jobs submitted from a worker land in its own queue and get stolen from there.
+            for (int k = 0; k < 10; k++) {
+                pool.submit([&count] { count++; });
+            }
+        });
+    }
+    pool.wait_idle();
+    EXPECT_EQ(count.load(), 1100);
+}
+
+TEST(ThreadPool, WaitIdleRethrowsJobException) {
+    parallel::ThreadPool pool(2);
+    std::atomic<int> count{0};
+    pool.submit([] { throw std::runtime_error("job failed"); });
+    for (int i = 0; i < 10; i++) {
+        pool.submit([&count] { count++; });
+    }
+    EXPECT_THROW(pool.wait_idle(), std::runtime_error);
+    EXPECT_EQ(count.load(), 10);
+    EXPECT_NO_THROW(pool.wait_idle());
+}
+
+TEST(BatchRunner, MatchesSequentialSimulation) {
+    std::mt19937 rng(11);
+    const int periods[] = {4, 5, 6, 8, 10, 12, 15, 20};
+    std::vector<std::unique_ptr<Task> > owned;
+    std::vector<std::vector<Task *> > task_sets(40);
+    for (auto &tasks: task_sets) {
+        for (int k = 0; k < 4; k++) {
+            int p = periods[rng() % 8];
+            int c = 1 + static_cast<int>(rng() % (p / 2));
+            owned.push_back(std::make_unique<PeriodicTask>(time::createTimeDurationMs(p), time::createTimeDurationMs(c)));
+            tasks.push_back(owned.back().get());
+        }
+    }
+    const std::vector<schedulers::PreemptivePolicy> policies = {
+        schedulers::PreemptivePolicy::EDF, schedulers::PreemptivePolicy::RM, schedulers::PreemptivePolicy::LLF
+    };
+
+    parallel::BatchRunner runner(4);
+    auto summary = runner.run(task_sets, policies, 2);
+    ASSERT_EQ(summary.results().size(), task_sets.size() * policies.size());
+
+    size_t nschedulable_edf = 0;
+    for (size_t s = 0; s < task_sets.size(); s++) {
+        for (size_t p = 0; p < policies.size(); p++) {
+            auto sched = schedulers::make_preemptive_scheduler(task_sets[s], policies[p]);
+            sched->set_clock(std::make_unique<time::VirtualClock>());
+            sched->set_verbose(false);
+            sched->run_scheduler(2);
+            const auto &r = summary.result(s, p);
+            EXPECT_EQ(r.set_idx, s);
+            EXPECT_TRUE(r.error.empty());
+            EXPECT_EQ(r.stats.deadline_misses, sched->get_stats().deadline_misses);
+            EXPECT_EQ(r.stats.max_response_tm, sched->get_stats().max_response_tm);
+            EXPECT_EQ(r.schedulable, sched->get_stats().deadline_misses == 0);
+            if (p == 0 && r.schedulable) nschedulable_edf++;
+        }
+    }
+    EXPECT_EQ(summary.per_policy()[0].nschedulable, nschedulable_edf);
+    EXPECT_EQ(summary.per_policy()[0].nsets, task_sets.size());
+    EXPECT_NE(summary.to_string().find("LLF"), std::string::npos);
+}
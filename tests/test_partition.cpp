@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "rtss/clock.h"
+#include "rtss/analysis/partition.h"
+#include "rtss/metrics/recorder.h"
+#include "rtss/parallel/batch.h"
+#include "rtss/schedulers/partitioned.h"
+
+#include "test_util.h"
+
+using namespace rtss;
+using namespace test_util;
+using analysis::AcceptanceTest;
+using analysis::FitHeuristic;
+
+namespace {
+    // Sets of `n` tasks with periods from a small harmonic-ish pool and total utilisation near `target`.
+    std::vector<std::vector<std::unique_ptr<PeriodicTask> > > random_sets(size_t nsets, size_t n, double target,
+                                                                          unsigned seed) {
+        std::mt19937 rng(seed);
+        const int periods[] = {10, 20, 25, 40, 50, 100};
+        std::vector<std::vector<std::unique_ptr<PeriodicTask> > > sets(nsets);
+        for (auto &set: sets) {
+            for (size_t k = 0; k < n; k++) {
+                int p = periods[rng() % 6];
+                double u = target / static_cast<double>(n) * (0.5 + static_cast<double>(rng() % 100) / 100.0);
+                int c = std::max(1, std::min(p, static_cast<int>(u * p)));
+                set.push_back(make_periodic(p, c, p, static_cast<short>(k + 1)));
+            }
+        }
+        return sets;
+    }
+
+    std::vector<Task *> view(const std::vector<std::unique_ptr<PeriodicTask> > &owned) {
+        std::vector<Task *> tasks;
+        for (const auto &T: owned) tasks.push_back(T.get());
+        return tasks;
+    }
+}
+
+TEST(Partition, HeuristicsPickTheirCores) {
+    auto T1 = make_periodic(10, 5, 10, 1);
+    auto T2 = make_periodic(10, 5, 10, 2);
+    auto T3 = make_periodic(10, 3, 10, 3);
+    auto T4 = make_periodic(10, 3, 10, 4);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get(), T4.get()};
+
+    auto ff = analysis::partition_tasks(tasks, 2, FitHeuristic::FIRST_FIT, AcceptanceTest::EDF);
+    EXPECT_TRUE(ff.feasible);
+    EXPECT_EQ(ff.core_of, (std::vector<size_t>{0, 0, 1, 1}));
+    EXPECT_DOUBLE_EQ(ff.utilisation[0], 1.0);
+    // U = 1 exactly is left to the exact test.
+    EXPECT_EQ(ff.exact_tests, 1u);
+
+    auto wf = analysis::partition_tasks(tasks, 2, FitHeuristic::WORST_FIT, AcceptanceTest::EDF);
+    EXPECT_EQ(wf.core_of, (std::vector<size_t>{0, 1, 0, 1}));
+
+    // Best fit puts T4 with T3 (U = 0.6) rather than on an empty core.
+    auto bf = analysis::partition_tasks(tasks, 3, FitHeuristic::BEST_FIT, AcceptanceTest::EDF);
+    EXPECT_EQ(bf.core_of, (std::vector<size_t>{0, 0, 1, 1}));
+    EXPECT_TRUE(bf.tasks_on[2].empty());
+    EXPECT_NE(bf.to_string(tasks).find("core 1: T3 T4"), std::string::npos);
+}
+
+TEST(Partition, DecreasingOrderFitsWhatListOrderDoesNot) {
+    auto T1 = make_periodic(10, 4, 10, 1);
+    auto T2 = make_periodic(10, 4, 10, 2);
+    auto T3 = make_periodic(10, 6, 10, 3);
+    auto T4 = make_periodic(10, 6, 10, 4);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get(), T4.get()};
+
+    auto ff = analysis::partition_tasks(tasks, 2, FitHeuristic::FIRST_FIT, AcceptanceTest::RM);
+    EXPECT_FALSE(ff.feasible);
+    EXPECT_EQ(ff.unassigned, 1u);
+    EXPECT_EQ(ff.core_of[3], analysis::Partition::UNASSIGNED);
+    EXPECT_NE(ff.to_string(tasks).find("unassigned: T4"), std::string::npos);
+
+    auto ffd = analysis::partition_tasks(tasks, 2, FitHeuristic::FIRST_FIT_DECREASING, AcceptanceTest::RM);
+    EXPECT_TRUE(ffd.feasible);
+    EXPECT_EQ(ffd.core_of, (std::vector<size_t>{0, 1, 0, 1}));
+}
+
+TEST(Partition, ExactTestsDecideBeyondTheBounds) {
+    // Harmonic periods: U = 1 fails the hyperbolic bound but RM schedules it.
+    auto T1 = make_periodic(2, 1, 2, 1);
+    auto T2 = make_periodic(4, 1, 4, 2);
+    auto T3 = make_periodic(8, 2, 8, 3);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get()};
+    auto rm = analysis::partition_tasks(tasks, 1, FitHeuristic::FIRST_FIT, AcceptanceTest::RM);
+    EXPECT_TRUE(rm.feasible);
+    EXPECT_GE(rm.exact_tests, 1u);
+
+    // Constrained deadlines: U = 0.6, but the two jobs due at 3 need 4 units. EDF and DM both
+    // need a second core.
+    auto C1 = make_periodic(10, 2, 3, 1);
+    auto C2 = make_periodic(10, 2, 3, 2);
+    auto C3 = make_periodic(10, 2, 10, 3);
+    std::vector<Task *> constrained = {C1.get(), C2.get(), C3.get()};
+    for (AcceptanceTest test: {AcceptanceTest::EDF, AcceptanceTest::DM}) {
+        auto one = analysis::partition_tasks(constrained, 1, FitHeuristic::FIRST_FIT, test);
+        EXPECT_EQ(one.unassigned, 1u) << analysis::to_string(test);
+        EXPECT_EQ(one.core_of[1], analysis::Partition::UNASSIGNED) << analysis::to_string(test);
+        auto two = analysis::partition_tasks(constrained, 2, FitHeuristic::FIRST_FIT, test);
+        EXPECT_EQ(two.core_of, (std::vector<size_t>{0, 1, 0})) << analysis::to_string(test);
+    }
+
+    AperiodicTask A(time::ZERO_DURATION, time::createTimeDurationMs(1));
+    std::vector<Task *> mixed = {T1.get(), &A};
+    EXPECT_THROW(analysis::partition_tasks(mixed, 2, FitHeuristic::FIRST_FIT, AcceptanceTest::EDF),
+                 std::runtime_error);
+    EXPECT_THROW(analysis::partition_tasks(tasks, 0, FitHeuristic::FIRST_FIT, AcceptanceTest::EDF),
+                 std::runtime_error);
+}
+
+TEST(PartitionedScheduler, MatchesTheCoresRunSeparately) {
+    auto sets = random_sets(10, 12, 3.2, 11);
+    size_t nrun = 0;
+    for (auto &owned: sets) {
+        std::vector<Task *> tasks = view(owned);
+        auto partition = analysis::partition_tasks(tasks, 4, FitHeuristic::WORST_FIT_DECREASING, AcceptanceTest::EDF);
+        if (!partition.feasible) continue;
+        nrun++;
+
+        schedulers::PartitionedScheduler sched(tasks, partition, schedulers::PreemptivePolicy::EDF, 2);
+        metrics::MetricsRecorder recorder(tasks);
+        sched.add_observer(&recorder);
+        sched.set_clock(std::make_unique<time::VirtualClock>());
+        sched.set_verbose(false);
+        sched.run_scheduler(2);
+        const auto &stats = sched.get_stats();
+        EXPECT_EQ(stats.deadline_misses, 0u);
+        EXPECT_EQ(sched.get_clock().now(), 2 * sched.get_hyperperiod());
+
+        size_t completed = 0;
+        for (size_t c = 0; c < sched.get_ncores(); c++) {
+            std::vector<Task *> on_core;
+            for (size_t i: partition.tasks_on[c]) on_core.push_back(tasks[i]);
+            if (on_core.empty()) continue;
+            auto alone = schedulers::make_preemptive_scheduler(on_core, schedulers::PreemptivePolicy::EDF);
+            alone->set_clock(std::make_unique<time::VirtualClock>());
+            alone->set_verbose(false);
+            alone->run_scheduler(static_cast<size_t>(2 * sched.get_hyperperiod() / alone->get_hyperperiod()));
+            EXPECT_EQ(sched.get_core_stats(c).completed_jobs, alone->get_stats().completed_jobs);
+            EXPECT_EQ(sched.get_core_stats(c).preemptions, alone->get_stats().preemptions);
+            for (size_t k = 0; k < on_core.size(); k++) {
+                EXPECT_EQ(stats.max_response_tm[partition.tasks_on[c][k]], alone->get_stats().max_response_tm[k]);
+            }
+            completed += alone->get_stats().completed_jobs;
+        }
+        EXPECT_EQ(stats.completed_jobs, completed);
+        EXPECT_EQ(recorder.total().completed_jobs, completed);
+        EXPECT_EQ(recorder.total().migrations, 0u);
+        EXPECT_LE(recorder.ncores(), 4u);
+        for (size_t i = 0; i < tasks.size(); i++) {
+            EXPECT_EQ(recorder.task(i).response_tm.max(), time::to_ns(stats.max_response_tm[i]));
+        }
+    }
+    EXPECT_GT(nrun, 0u);
+
+    auto T1 = make_periodic(10, 8, 10, 1);
+    auto T2 = make_periodic(10, 8, 10, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+    auto partition = analysis::partition_tasks(tasks, 1, FitHeuristic::FIRST_FIT, AcceptanceTest::EDF);
+    EXPECT_THROW(schedulers::PartitionedScheduler(tasks, partition, schedulers::PreemptivePolicy::EDF),
+                 std::runtime_error);
+}
+
+TEST(BatchRunner, PartitioningMatchesSequentialRuns) {
+    auto sets = random_sets(40, 16, 3.5, 3);
+    std::vector<std::vector<Task *> > task_sets;
+    for (auto &owned: sets) task_sets.push_back(view(owned));
+    const std::vector<FitHeuristic> heuristics = {
+        FitHeuristic::FIRST_FIT, FitHeuristic::BEST_FIT, FitHeuristic::WORST_FIT,
+        FitHeuristic::FIRST_FIT_DECREASING, FitHeuristic::BEST_FIT_DECREASING, FitHeuristic::WORST_FIT_DECREASING
+    };
+
+    parallel::BatchRunner runner(4);
+    auto summary = runner.run_partitioning(task_sets, 4, heuristics, AcceptanceTest::RM);
+    ASSERT_EQ(summary.results().size(), task_sets.size() * heuristics.size());
+    for (size_t s = 0; s < task_sets.size(); s++) {
+        for (size_t h = 0; h < heuristics.size(); h++) {
+            auto expected = analysis::partition_tasks(task_sets[s], 4, heuristics[h], AcceptanceTest::RM);
+            const auto &r = summary.result(s, h);
+            EXPECT_TRUE(r.error.empty());
+            EXPECT_EQ(r.partition.core_of, expected.core_of);
+            EXPECT_EQ(r.partition.exact_tests, expected.exact_tests);
+        }
+    }
+    for (const auto &h: summary.per_heuristic()) {
+        EXPECT_EQ(h.nsets, task_sets.size());
+        EXPECT_GT(h.nfeasible, 0u);
+    }
+    EXPECT_NE(summary.to_string().find("WFD"), std::string::npos);
+}
@@ -0,0 +1,414 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "rtss/containers/indexed_heap.h"
+#include "rtss/containers/priority_bitmap.h"
+#include "rtss/containers/slab_pool.h"
+#include "rtss/io/input.h"
+#include "rtss/schedulers/preemptive.h"
+#include "rtss/schedulers/static.h"
+#include "rtss/schedulers/table_generator.h"
+#include "rtss/trace/chrome_trace.h"
+
+#include "test_util.h"
+
+using namespace rtss;
+using namespace test_util;
+
+TEST(IndexedHeap, PopsInKeyOrderAfterUpdates) {
+    const size_t n = 200;
+    containers::IndexedHeap<int> heap(n);
+    std::mt19937 rng(7);
+    std::vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = static_cast<int>(rng() % 1000);
+        heap.push(i, keys[i]);
+    }
+    for (size_t i = 0; i < n; i += 3) {
+        keys[i] = static_cast<int>(rng() % 1000);
+        heap.update(i, keys[i]);
+    }
+    heap.erase(5);
+    EXPECT_FALSE(heap.contains(5));
+    EXPECT_THROW(heap.push(6, 0), std::runtime_error);
+
+    int last = -1;
+    size_t popped = 0;
+    while (!heap.empty()) {
+        size_t i = heap.top();
+        EXPECT_GE(keys[i], last);
+        last = keys[i];
+        heap.pop();
+        popped++;
+    }
+    EXPECT_EQ(popped, n - 1);
+}
+
+TEST(SlabPool, RecyclesReleasedObjects) {
+    containers::SlabPool<Job> pool(4);
+    std::vector<Job *> live;
+    for (size_t k = 0; k < 10; k++) {
+        live.push_back(pool.acquire(k, k, time::ZERO_DURATION, time::ZERO_DURATION, time::ZERO_DURATION));
+    }
+    // Slabs of 4 and 8.
+    EXPECT_EQ(pool.nslabs(), 2u);
+    EXPECT_EQ(pool.capacity(), 12u);
+    EXPECT_EQ(pool.in_use(), 10u);
+    for (size_t k = 0; k < 10; k++) EXPECT_EQ(live[k]->task_idx, k);
+
+    Job *freed = live[3];
+    pool.release(freed);
+    EXPECT_EQ(pool.acquire(7, 0, time::ZERO_DURATION, time::ZERO_DURATION, time::ZERO_DURATION), freed);
+    for (Job *job: live) pool.release(job);
+    EXPECT_EQ(pool.in_use(), 0u);
+    for (size_t k = 0; k < 12; k++) {
+        (void) pool.acquire(k, k, time::ZERO_DURATION, time::ZERO_DURATION, time::ZERO_DURATION);
+    }
+    EXPECT_EQ(pool.capacity(), 12u);
+    (void) pool.acquire(0, 0, time::ZERO_DURATION, time::ZERO_DURATION, time::ZERO_DURATION);
+    EXPECT_EQ(pool.capacity(), 28u);
+
+    JobQueue queue;
+    Job a(0, 0, time::ZERO_DURATION, time::ZERO_DURATION, time::ZERO_DURATION);
+    Job b(0, 1, time::ZERO_DURATION, time::ZERO_DURATION, time::ZERO_DURATION);
+    queue.push_back(&a);
+    queue.push_back(&b);
+    EXPECT_EQ(queue.head(), &a);
+    EXPECT_EQ(a.next, &b);
+    EXPECT_EQ(queue.pop_front(), &a);
+    EXPECT_EQ(&queue.front(), &b);
+    EXPECT_EQ(queue.pop_front(), &b);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(PreemptiveEDF, PreemptsForEarlierDeadline) {
+    auto T1 = make_periodic(0, 20, 6, 20, 1);
+    auto T2 = make_periodic(2, 20, 2, 5, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+
+    schedulers::PEDF edf(tasks);
+    const auto &stats = simulate(edf, 1);
+
+    EXPECT_EQ(time::toInt(edf.get_hyperperiod()), 20);
+    EXPECT_EQ(stats.released_jobs, 2u);
+    EXPECT_EQ(stats.completed_jobs, 2u);
+    EXPECT_EQ(stats.preemptions, 1u);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[0]), 8);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[1]), 2);
+    EXPECT_EQ(time::toInt(edf.get_clock().now()), 20);
+}
+
+TEST(PreemptiveEDF, FullUtilisationHasNoMisses) {
+    auto T1 = make_periodic(0, 4, 1, 4, 1);
+    auto T2 = make_periodic(0, 6, 3, 6, 2);
+    auto T3 = make_periodic(0, 12, 3, 12, 3);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get()};
+
+    schedulers::PEDF edf(tasks);
+    const auto &stats = simulate(edf, 10);
+
+    EXPECT_EQ(stats.released_jobs, 10u * (3 + 2 + 1));
+    EXPECT_EQ(stats.completed_jobs, stats.released_jobs);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+}
+
+TEST(PreemptiveEDF, OverloadReportsMisses) {
+    auto T1 = make_periodic(0, 10, 6, 10, 1);
+    auto T2 = make_periodic(0, 10, 6, 10, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+
+    schedulers::PEDF edf(tasks);
+    const auto &stats = simulate(edf, 5);
+
+    EXPECT_GT(stats.deadline_misses, 0u);
+}
+
+TEST(PreemptiveLLF, SchedulesFeasibleSet) {
+    auto T1 = make_periodic(0, 4, 1, 4, 1);
+    auto T2 = make_periodic(0, 6, 3, 6, 2);
+    auto T3 = make_periodic(0, 12, 3, 12, 3);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get()};
+
+    schedulers::PLLF llf(tasks);
+    const auto &stats = simulate(llf, 4);
+
+    EXPECT_EQ(stats.completed_jobs, stats.released_jobs);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+}
+
+TEST(PreemptiveEDF, AperiodicJobsRunInBackground) {
+    auto T1 = make_periodic(0, 5, 2, 5, 1);
+    AperiodicTask A(time::createTimeDurationMs(0), time::createTimeDurationMs(4));
+    A.set_id(2);
+    std::vector<Task *> tasks = {T1.get(), &A};
+
+    schedulers::PEDF edf(tasks);
+    const auto &stats = simulate(edf, 2);
+
+    EXPECT_EQ(stats.completed_jobs, 3u);
+    // A runs 2..5 and 7..8.
+    EXPECT_EQ(time::toInt(stats.max_response_tm[1]), 8);
+}
+
+namespace {
+    struct CompletionLog : schedulers::SchedulerObserver {
+        struct Entry {
+            size_t task_idx;
+            time::TimeDuration t, release, abs_dl;
+        };
+
+        std::vector<Entry> completed;
+
+        void on_complete(time::TimeDuration t, size_t task_idx, time::TimeDuration release,
+                         time::TimeDuration abs_dl) override {
+            completed.push_back({task_idx, t, release, abs_dl});
+        }
+    };
+}
+
+TEST(PreemptiveEDF, JobsOfATaskOverlapWhenDeadlinesExceedPeriods) {
+    // T2 holds the processor for 0..6 while T1 releases jobs at 0 and 4, each with its own
+    // deadline 12 after its release.
+    auto T1 = make_periodic(0, 4, 2, 12, 1);
+    auto T2 = make_periodic(0, 12, 6, 6, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+
+    schedulers::PEDF edf(tasks);
+    CompletionLog log;
+    edf.add_observer(&log);
+    const auto &stats = simulate(edf, 2);
+    EXPECT_EQ(stats.completed_jobs, 8u);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[0]), 8);
+
+    std::vector<int64_t> releases, finishes;
+    for (const auto &e: log.completed) {
+        if (e.task_idx != 0) continue;
+        releases.push_back(time::toInt(e.release));
+        finishes.push_back(time::toInt(e.t));
+        EXPECT_EQ(e.abs_dl, e.release + time::createTimeDurationMs(12));
+    }
+    EXPECT_EQ(releases, (std::vector<int64_t>{0, 4, 8, 12, 16, 20}));
+    EXPECT_EQ(finishes, (std::vector<int64_t>{8, 10, 12, 20, 22, 24}));
+
+    // Every job went back to the pool, and a longer run reuses the same slabs.
+    EXPECT_EQ(edf.get_job_pool().in_use(), 0u);
+    const size_t capacity = edf.get_job_pool().capacity();
+    EXPECT_GT(capacity, 0u);
+    edf.run_scheduler(1000);
+    EXPECT_EQ(edf.get_stats().completed_jobs, 4000u);
+    EXPECT_EQ(edf.get_job_pool().capacity(), capacity);
+}
+
+TEST(PriorityBitmap, FindsHighestSetLevelAcrossLayers) {
+    containers::PriorityBitmap bm(5000);
+    EXPECT_TRUE(bm.empty());
+    bm.set(4999);
+    bm.set(64);
+    bm.set(4095);
+    EXPECT_EQ(bm.first(), 64u);
+    bm.clear(64);
+    EXPECT_EQ(bm.first(), 4095u);
+    EXPECT_TRUE(bm.test(4999));
+    EXPECT_FALSE(bm.test(64));
+    bm.clear(4095);
+    bm.clear(4999);
+    EXPECT_TRUE(bm.empty());
+    EXPECT_THROW(bm.set(5000), std::out_of_range);
+}
+
+TEST(PreemptiveFixedPriority, RateMonotonicPreemptsLongerPeriod) {
+    auto T1 = make_periodic(0, 20, 10, 20, 1);
+    auto T2 = make_periodic(1, 5, 2, 5, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+
+    schedulers::PRM rm(tasks);
+    EXPECT_EQ(rm.get_priority_level(1), 0u);
+    EXPECT_EQ(rm.get_priority_level(0), 1u);
+    const auto &stats = simulate(rm, 1);
+
+    EXPECT_EQ(stats.deadline_misses, 0u);
+    EXPECT_GE(stats.preemptions, 1u);
+    // T1 runs 0..1, 3..6, 8..11, 13..16.
+    EXPECT_EQ(time::toInt(stats.max_response_tm[0]), 16);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[1]), 2);
+}
+
+TEST(PreemptiveFixedPriority, RateMonotonicMissesWhereEDFDoesNot) {
+    auto T1 = make_periodic(0, 5, 2, 5, 1);
+    auto T2 = make_periodic(0, 7, 4, 7, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+
+    schedulers::PRM rm(tasks);
+    schedulers::PEDF edf(tasks);
+    EXPECT_GT(simulate(rm, 1).deadline_misses, 0u);
+    EXPECT_EQ(simulate(edf, 1).deadline_misses, 0u);
+}
+
+TEST(PreemptiveFixedPriority, DeadlineMonotonicOrdersOnRelativeDeadline) {
+    auto T1 = make_periodic(0, 10, 3, 4, 1);
+    auto T2 = make_periodic(0, 5, 1, 5, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+
+    schedulers::PDM dm(tasks);
+    EXPECT_EQ(dm.get_priority_level(0), 0u);
+    const auto &stats = simulate(dm, 1);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[0]), 3);
+    EXPECT_EQ(time::toInt(stats.max_response_tm[1]), 4);
+}
+
+TEST(PreemptiveFixedPriority, RejectsIncompletePriorityOrder) {
+    auto T1 = make_periodic(0, 10, 3, 10, 1);
+    auto T2 = make_periodic(0, 5, 1, 5, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+
+    EXPECT_THROW(schedulers::PreemptiveFixedPriorityScheduler(tasks, {0}), std::runtime_error);
+    EXPECT_THROW(schedulers::PreemptiveFixedPriorityScheduler(tasks, {1, 1}), std::runtime_error);
+}
+
+TEST(TableGenerator, RecordsEDFScheduleWithIdleAndReset) {
+    auto T1 = make_periodic(0, 20, 6, 20, 1);
+    auto T2 = make_periodic(2, 20, 2, 5, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+    TaskTableBuilder builder;
+    auto stats = schedulers::generate_task_table(tasks, schedulers::PreemptivePolicy::EDF, builder);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+
+    const std::vector<std::pair<int, int16_t> > expected = {{0, 1}, {2, 2}, {4, 1}, {8, 0}, {20, -1}};
+    const auto &entries = builder.entries();
+    ASSERT_EQ(entries.size(), expected.size());
+    for (size_t k = 0; k < expected.size(); k++) {
+        EXPECT_EQ(time::toInt(entries[k].start_time), expected[k].first);
+        EXPECT_EQ(entries[k].task_id, expected[k].second);
+    }
+}
+
+TEST(TableGenerator, TableDrivenSchedulerReplaysGeneratedTable) {
+    auto T1 = make_periodic(0, 4, 1, 4, 1);
+    auto T2 = make_periodic(0, 6, 2, 6, 2);
+    auto T3 = make_periodic(0, 12, 3, 12, 3);
+    std::vector<Task *> tasks = {T1.get(), T2.get(), T3.get()};
+    TaskTableBuilder builder;
+    auto stats = schedulers::generate_task_table(tasks, schedulers::PreemptivePolicy::RM, builder);
+    EXPECT_EQ(stats.deadline_misses, 0u);
+    // Segments of the same task are merged, so consecutive entries always differ.
+    const auto &entries = builder.entries();
+    for (size_t k = 1; k < entries.size(); k++) {
+        EXPECT_NE(entries[k].task_id, entries[k - 1].task_id);
+        EXPECT_LT(entries[k - 1].start_time, entries[k].start_time);
+    }
+    EXPECT_EQ(entries.back().task_id, static_cast<int16_t>(TaskID::RESET));
+
+    TaskTable tbl = builder.build(StaticSchedulingMode::TASK_BASED);
+    schedulers::TableDrivenScheduler sched(tasks, tbl);
+    sched.set_clock(std::make_unique<time::VirtualClock>());
+    sched.set_verbose(false);
+    sched.run_scheduler(2);
+    EXPECT_EQ(time::toInt(sched.get_clock().now()), 24);
+}
+
+TEST(TableGenerator, WritesCSVReadableByTableParser) {
+    auto T1 = make_periodic(0, 5, 2, 5, 1);
+    auto T2 = make_periodic(1, 7, 3, 7, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+    TaskTableBuilder builder;
+    schedulers::generate_task_table(tasks, schedulers::PreemptivePolicy::EDF, builder);
+
+    std::filesystem::path csv_path = std::filesystem::temp_directory_path() / "rtss_test_generated_table.csv";
+    io::write_task_table_csv(builder, csv_path);
+    TaskTableBuilder parsed;
+    io::read_task_table_from_csv(parsed, csv_path.string());
+    std::filesystem::remove(csv_path);
+
+    ASSERT_EQ(parsed.size(), builder.size());
+    for (size_t k = 0; k < builder.size(); k++) {
+        EXPECT_EQ(parsed.entries()[k].start_time, builder.entries()[k].start_time);
+        EXPECT_EQ(parsed.entries()[k].task_id, builder.entries()[k].task_id);
+    }
+}
+
+namespace {
+    std::string read_file(const std::filesystem::path &p) {
+        std::ifstream ifs(p, std::ios::binary);
+        return {std::istreambuf_iterator<char>(ifs), {}};
+    }
+
+    size_t count_of(const std::string &s, const std::string &what) {
+        size_t n = 0;
+        for (size_t pos = s.find(what); pos != std::string::npos; pos = s.find(what, pos + 1)) n++;
+        return n;
+    }
+}
+
+TEST(ChromeTrace, StreamsSlicesAndMarkersOfARun) {
+    auto T1 = make_periodic(0, 20, 10, 20, 1);
+    auto T2 = make_periodic(1, 5, 2, 5, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+    const auto path = std::filesystem::temp_directory_path() / "rtss_test_trace.json";
+
+    schedulers::PRM rm(tasks);
+    trace::ChromeTraceWriter writer(path, tasks);
+    rm.add_observer(&writer);
+    simulate(rm, 1);
+    std::string json = read_file(path);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[\n", 0), 0u);
+    EXPECT_EQ(json.substr(json.size() - 2), "}\n");
+    // T1 runs 0..1, 3..6, 8..11, 13..16 and T2 the gaps up to 18; each slice is on the CPU and the task track.
+    EXPECT_EQ(count_of(json, "\"ph\":\"X\""), 2u * 8);
+    EXPECT_NE(json.find("{\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":0,\"cat\":\"exec\",\"name\":\"T1\",\"dur\":1000}"),
+              std::string::npos);
+    EXPECT_NE(json.find("{\"ph\":\"X\",\"pid\":2,\"tid\":2,\"ts\":16000,\"cat\":\"exec\",\"name\":\"T2\",\"dur\":2000}"),
+              std::string::npos);
+    EXPECT_EQ(count_of(json, "\"name\":\"release\""), 1u + 4);
+    EXPECT_EQ(count_of(json, "\"name\":\"preempted\""), 3u);
+    EXPECT_NE(json.find("\"args\":{\"response_us\":16000,\"slack_us\":4000}"), std::string::npos);
+    EXPECT_EQ(count_of(json, "\"name\":\"deadline miss\""), 0u);
+    EXPECT_THROW(writer.on_dispatch(time::ZERO_DURATION, 0, 0), std::runtime_error);
+}
+
+TEST(ChromeTrace, MarksDeadlineMisses) {
+    auto T1 = make_periodic(0, 10, 6, 10, 1);
+    auto T2 = make_periodic(0, 10, 6, 10, 2);
+    std::vector<Task *> tasks = {T1.get(), T2.get()};
+    const auto path = std::filesystem::temp_directory_path() / "rtss_test_trace_miss.json";
+
+    schedulers::PEDF edf(tasks);
+    trace::ChromeTraceWriter writer(path, tasks);
+    edf.add_observer(&writer);
+    const auto &stats = simulate(edf, 2);
+    std::string json = read_file(path);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(count_of(json, "\"name\":\"deadline miss\""), stats.deadline_misses);
+    EXPECT_GT(stats.deadline_misses, 0u);
+    EXPECT_GT(count_of(json, "\"slack_us\":-"), 0u);
+}
+
+TEST(ChromeTrace, AperiodicJobsHaveNoSlack) {
+    auto T1 = make_periodic(0, 5, 2, 5, 1);
+    AperiodicTask A(time::createTimeDurationMs(0), time::createTimeDurationMs(4));
+    A.set_id(2);
+    std::vector<Task *> tasks = {T1.get(), &A};
+    const auto path = std::filesystem::temp_directory_path() / "rtss_test_trace_aperiodic.json";
+
+    schedulers::PEDF edf(tasks);
+    trace::ChromeTraceWriter writer(path, tasks);
+    edf.add_observer(&writer);
+    const auto &stats = simulate(edf, 2);
+    std::string json = read_file(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(stats.completed_jobs, 3u);
+    EXPECT_EQ(count_of(json, "\"name\":\"complete\""), 3u);
+    EXPECT_EQ(count_of(json, "\"slack_us\""), 2u);
+    EXPECT_NE(json.find("\"args\":{\"response_us\":8000}"), std::string::npos);
+}
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <fstream>
+#include <iterator>
+#include <string>
 
+#include "rtss/io/binary.h"
 #include "rtss/io/input.h"
 #include "rtss/task.h"
 #include "rtss/time.h"
@@ -113,3 +117,306 @@ TEST_F(ReadTaskTableFromCSVTest, ParsedContentIsCorrect) {
         tbl->increment_k();
     }
 }
+
+namespace {
+    fs::path write_tmp_csv(const char *name, const std::string &content) {
+        fs::path p = fs::temp_directory_path() / name;
+        std::ofstream ofs(p, std::ios::binary);
+        ofs << content;
+        return p;
+    }
+}
+
+TEST(ReadCSV, SkipsCommentsAndAcceptsCRLF) {
+    fs::path p = write_tmp_csv("rtss_test_crlf.csv",
+                               "type,phase,period,wcet,rel_dl\r\n# comment\r\n\r\nP, 2, 10, 3, 8\r\nA,4,0,1,0");
+    std::vector<rtss::PeriodicTask *> periodic;
+    std::vector<rtss::AperiodicTask *> aperiodic;
+    rtss::io::Metadata md;
+    ASSERT_NO_THROW(rtss::io::read_task_list_from_csv(periodic, aperiodic, p.string(), md));
+    ASSERT_EQ(periodic.size(), 1u);
+    ASSERT_EQ(aperiodic.size(), 1u);
+    EXPECT_FALSE(md.fully_periodic);
+    EXPECT_EQ(periodic[0]->get_id(), 1);
+    EXPECT_EQ(periodic[0]->get_phase(), rtss::time::createTimeDurationMs(2));
+    EXPECT_EQ(periodic[0]->get_rel_dl(), rtss::time::createTimeDurationMs(8));
+    EXPECT_EQ(aperiodic[0]->get_id(), 2);
+    EXPECT_EQ(aperiodic[0]->get_wcet(), rtss::time::createTimeDurationMs(1));
+    for (auto *t: periodic) delete t;
+    for (auto *t: aperiodic) delete t;
+    fs::remove(p);
+}
+
+TEST(ReadCSV, TimesTakeUnitSuffixesAndRoundTrip) {
+    using namespace std::chrono;
+    fs::path p = write_tmp_csv("rtss_test_units.csv",
+                               "type,phase,period,wcet,rel_dl\nP,0,1s,250us,800us\nP,3ms,20,5ms,20\n");
+    std::vector<rtss::Task *> tasks;
+    rtss::io::Metadata md;
+    if (rtss::time::TICK_NS > 1'000) {
+        // 250us is not a whole number of ticks.
+        EXPECT_THROW(rtss::io::read_task_list_from_csv(tasks, p.string(), md), std::runtime_error);
+        for (auto *t: tasks) delete t;
+        fs::remove(p);
+        GTEST_SKIP() << "Sub-millisecond times need a tick of 1us or less";
+    }
+    ASSERT_NO_THROW(rtss::io::read_task_list_from_csv(tasks, p.string(), md));
+    ASSERT_EQ(tasks.size(), 2u);
+    auto *P = dynamic_cast<rtss::PeriodicTask *>(tasks[0]);
+    ASSERT_NE(P, nullptr);
+    EXPECT_EQ(P->get_period(), seconds(1));
+    EXPECT_EQ(P->get_wcet(), microseconds(250));
+    EXPECT_EQ(P->get_rel_dl(), microseconds(800));
+    EXPECT_EQ(tasks[1]->get_phase(), milliseconds(3));
+
+    // Whole milliseconds are written as bare numbers, the rest with a suffix.
+    fs::path out = fs::temp_directory_path() / "rtss_test_units_out.csv";
+    rtss::io::write_task_list_csv(tasks, out);
+    std::ifstream ifs(out);
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, "type,phase,period,wcet,rel_dl\nP,0,1000,250us,800us\nP,3,20,5,20\n");
+    for (auto *t: tasks) delete t;
+
+    p = write_tmp_csv("rtss_test_units.csv", "time,task_id\n0,1\n1500us,2\n2,0\n");
+    rtss::TaskTableBuilder builder;
+    ASSERT_NO_THROW(rtss::io::read_task_table_from_csv(builder, p.string()));
+    ASSERT_EQ(builder.size(), 3u);
+    EXPECT_EQ(builder.entries()[1].start_time, microseconds(1500));
+    rtss::io::write_task_table_csv(builder, out);
+    rtss::TaskTableBuilder reread;
+    ASSERT_NO_THROW(rtss::io::read_task_table_from_csv(reread, out.string()));
+    ASSERT_EQ(reread.size(), 3u);
+    EXPECT_EQ(reread.entries()[1].start_time, microseconds(1500));
+
+    p = write_tmp_csv("rtss_test_units.csv", "time,task_id\n0,1\n5min,2\n");
+    rtss::TaskTableBuilder bad;
+    EXPECT_THROW(rtss::io::read_task_table_from_csv(bad, p.string()), std::runtime_error);
+    fs::remove(p);
+    fs::remove(out);
+}
+
+TEST(ReadCSV, ReportsLineNumberOfMalformedLine) {
+    fs::path p = write_tmp_csv("rtss_test_bad_line.csv", "time,task_id\n0,1\n# comment\n5,x\n");
+    rtss::TaskTableBuilder builder;
+    try {
+        rtss::io::read_task_table_from_csv(builder, p.string());
+        FAIL() << "Expected a parse error";
+    } catch (const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("line 4"), std::string::npos) << e.what();
+    }
+    fs::remove(p);
+}
+
+TEST(ReadCSV, RejectsBadHeaderAndOutOfRangeTaskId) {
+    fs::path p = write_tmp_csv("rtss_test_bad_header.csv", "time,id\n0,1\n");
+    rtss::TaskTableBuilder builder;
+    EXPECT_THROW(rtss::io::read_task_table_from_csv(builder, p.string()), std::runtime_error);
+    p = write_tmp_csv("rtss_test_bad_header.csv", "time,task_id\n0,-2\n");
+    EXPECT_THROW(rtss::io::read_task_table_from_csv(builder, p.string()), std::runtime_error);
+    p = write_tmp_csv("rtss_test_bad_header.csv", "time,task_id\n0,40000\n");
+    EXPECT_THROW(rtss::io::read_task_table_from_csv(builder, p.string()), std::runtime_error);
+    fs::remove(p);
+    EXPECT_THROW(rtss::io::read_task_table_from_csv(builder, p.string()), std::runtime_error);
+}
+
+namespace {
+    // `nrows` fixed-width rows with times 0, 1, 2, ... that restart at 0 on row `restart`.
+    fs::path write_big_table(const char *name, size_t nrows, size_t restart) {
+        std::string content = "time,task_id\n";
+        char row[16];
+        for (size_t r = 0; r < nrows; r++) {
+            std::snprintf(row, sizeof(row), "%07zu,%zu\n", r < restart ? r : r - restart, r % 10);
+            content += row;
+        }
+        return write_tmp_csv(name, content);
+    }
+}
+
+TEST(ReadCSV, ParallelTableParseMatchesSequential) {
+    constexpr size_t NROWS = 16 * 32768; // ~5 MB, enough for 4 threads
+    fs::path p = write_big_table("rtss_test_big_table.csv", NROWS, NROWS);
+    rtss::TaskTableBuilder seq, par;
+    rtss::io::read_task_table_from_csv(seq, p.string());
+    rtss::io::read_task_table_from_csv(par, p.string(), 4);
+    ASSERT_EQ(seq.size(), NROWS);
+    ASSERT_EQ(par.size(), NROWS);
+    for (size_t i = 0; i < NROWS; i++) {
+        ASSERT_EQ(par.entries()[i].start_time, seq.entries()[i].start_time) << i;
+        ASSERT_EQ(par.entries()[i].task_id, seq.entries()[i].task_id) << i;
+    }
+    fs::remove(p);
+}
+
+TEST(ReadCSV, ParallelTableParseChecksOrderAcrossChunks) {
+    constexpr size_t NROWS = 16 * 32768;
+    // With 4 threads the file is cut into 16 chunks of NROWS / 16 rows, and the
+    // second one starts on row NROWS / 16 + 1, so the restart lands on a boundary.
+    constexpr size_t RESTART = NROWS / 16 + 1;
+    fs::path p = write_big_table("rtss_test_unsorted_table.csv", NROWS, RESTART);
+    for (size_t nthreads: {1, 4}) {
+        rtss::TaskTableBuilder builder;
+        try {
+            rtss::io::read_task_table_from_csv(builder, p.string(), nthreads);
+            FAIL() << "Expected an ordering error";
+        } catch (const std::runtime_error &e) {
+            EXPECT_NE(std::string(e.what()).find("line " + std::to_string(RESTART + 2)), std::string::npos)
+                    << e.what();
+        }
+        EXPECT_EQ(builder.size(), 0u);
+    }
+    fs::remove(p);
+}
+
+TEST(BinaryIO, TableRoundTripsInBothEncodings) {
+    fs::path csv = write_tmp_csv("rtss_test_bin_table.csv", "time,task_id\n0,1\n2,2\n5,0\n5,3\n1000,1\n1200,-1\n");
+    fs::path bin = fs::temp_directory_path() / "rtss_test_table.bin";
+    rtss::TaskTableBuilder expected;
+    rtss::io::read_task_table_from_csv(expected, csv.string());
+    for (bool delta: {false, true}) {
+        rtss::io::convert_task_table_csv_to_binary(csv.string(), bin, delta);
+        rtss::TaskTableBuilder decoded;
+        rtss::io::read_task_table_binary(decoded, bin.string());
+        ASSERT_EQ(decoded.size(), expected.size());
+        rtss::TaskTable tbl = rtss::io::load_task_table_binary(bin.string());
+        EXPECT_EQ(tbl.is_external(), !delta);
+        ASSERT_EQ(tbl.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_EQ(decoded.entries()[i].start_time, expected.entries()[i].start_time);
+            EXPECT_EQ(decoded.entries()[i].task_id, expected.entries()[i].task_id);
+            EXPECT_EQ(tbl.get_kth_entry(i).start_time, expected.entries()[i].start_time);
+            EXPECT_EQ(tbl.get_kth_entry(i).task_id, expected.entries()[i].task_id);
+        }
+    }
+    // Delta records: 40-byte header, then per record a 2-byte id and a varint time delta in ms,
+    // which takes 1 byte up to 127 ms (4 records here) and 2 bytes above (995 and 200 ms).
+    EXPECT_EQ(fs::file_size(bin), 40u + 6 * 2 + 4 * 1 + 2 * 2);
+
+    fs::path back = fs::temp_directory_path() / "rtss_test_bin_table_back.csv";
+    rtss::io::convert_task_table_binary_to_csv(bin.string(), back);
+    std::ifstream a(csv), b(back);
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(a), {}), std::string(std::istreambuf_iterator<char>(b), {}));
+    fs::remove(csv);
+    fs::remove(bin);
+    fs::remove(back);
+}
+
+TEST(BinaryIO, TaskListRoundTrips) {
+    fs::path csv = write_tmp_csv("rtss_test_bin_tasks.csv", "type,phase,period,wcet,rel_dl\nP,1,10,2,8\nA,4,0,3,0\n");
+    fs::path bin = fs::temp_directory_path() / "rtss_test_tasks.bin";
+    rtss::io::convert_task_list_csv_to_binary(csv.string(), bin);
+    std::vector<rtss::Task *> tasks;
+    rtss::io::Metadata md;
+    rtss::io::read_task_list_binary(tasks, bin.string(), md);
+    ASSERT_EQ(tasks.size(), 2u);
+    EXPECT_FALSE(md.fully_periodic);
+    auto *P = dynamic_cast<rtss::PeriodicTask *>(tasks[0]);
+    ASSERT_NE(P, nullptr);
+    EXPECT_EQ(P->get_id(), 1);
+    EXPECT_EQ(P->get_period(), rtss::time::createTimeDurationMs(10));
+    EXPECT_EQ(P->get_rel_dl(), rtss::time::createTimeDurationMs(8));
+    ASSERT_NE(dynamic_cast<rtss::AperiodicTask *>(tasks[1]), nullptr);
+    EXPECT_EQ(tasks[1]->get_id(), 2);
+    EXPECT_EQ(tasks[1]->get_wcet(), rtss::time::createTimeDurationMs(3));
+    for (auto *t: tasks) delete t;
+
+    fs::path back = fs::temp_directory_path() / "rtss_test_bin_tasks_back.csv";
+    rtss::io::convert_task_list_binary_to_csv(bin.string(), back);
+    std::ifstream a(csv), b(back);
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(a), {}), std::string(std::istreambuf_iterator<char>(b), {}));
+    fs::remove(csv);
+    fs::remove(bin);
+    fs::remove(back);
+}
+
+TEST(BinaryIO, RejectsForeignAndTruncatedFiles) {
+    fs::path p = write_tmp_csv("rtss_test_not_binary.bin", "time,task_id\n0,1\n2,2\n5,0\n5,3\n1000,1\n1200,-1\n");
+    EXPECT_THROW(rtss::io::load_task_table_binary(p.string()), std::runtime_error);
+
+    rtss::TaskTableBuilder builder;
+    builder.add_entry(1, rtss::time::createTimeDurationMs(0));
+    builder.add_entry(2, rtss::time::createTimeDurationMs(3));
+    rtss::io::write_task_table_binary(builder, p);
+    fs::resize_file(p, fs::file_size(p) - 1);
+    EXPECT_THROW(rtss::io::load_task_table_binary(p.string()), std::runtime_error);
+
+    // A table is not a task list.
+    rtss::io::write_task_table_binary(builder, p);
+    std::vector<rtss::Task *> tasks;
+    rtss::io::Metadata md;
+    EXPECT_THROW(rtss::io::read_task_list_binary(tasks, p.string(), md), std::runtime_error);
+    fs::remove(p);
+}
+
+TEST(TaskStore, LoadsTheSameTasksAsTheHeapReaderContiguously) {
+    fs::path p = write_tmp_csv("rtss_test_store.csv",
+                               "type,phase,period,wcet,rel_dl\nP,0,5,1,5\nA,3,0,2,0\n# comment\nP,0,10,2,10\n");
+    std::vector<rtss::Task *> heap;
+    rtss::io::Metadata heap_md, md;
+    rtss::io::read_task_list_from_csv(heap, p.string(), heap_md);
+
+    rtss::TaskStore store;
+    rtss::io::read_task_list_from_csv(store, p.string(), md);
+    ASSERT_EQ(store.size(), heap.size());
+    EXPECT_EQ(md.fully_periodic, heap_md.fully_periodic);
+    const auto &tasks = store.tasks();
+    for (size_t i = 0; i < tasks.size(); i++) {
+        EXPECT_EQ(tasks[i]->to_string(), heap[i]->to_string());
+        EXPECT_EQ(dynamic_cast<rtss::PeriodicTask *>(tasks[i]) != nullptr,
+                  dynamic_cast<rtss::PeriodicTask *>(heap[i]) != nullptr);
+        // One after the other in load order.
+        if (i > 0) {
+            auto gap = reinterpret_cast<const char *>(tasks[i]) - reinterpret_cast<const char *>(tasks[i - 1]);
+            EXPECT_GT(gap, 0);
+            EXPECT_LE(static_cast<size_t>(gap), sizeof(rtss::PeriodicTask));
+        }
+    }
+    for (auto *t: heap) delete t;
+    EXPECT_THROW(rtss::io::read_task_list_from_csv(store, p.string(), md), std::runtime_error);
+    fs::remove(p);
+}
+
+TEST(TaskStore, IsEmptyAfterAFailedLoadAndCanBeReused) {
+    fs::path p = write_tmp_csv("rtss_test_store.csv", "type,phase,period,wcet,rel_dl\nP,0,5,1,5\nX,0,5,1,5\n");
+    rtss::TaskStore store;
+    rtss::io::Metadata md;
+    EXPECT_THROW(rtss::io::read_task_list_from_csv(store, p.string(), md), std::runtime_error);
+    EXPECT_TRUE(store.empty());
+
+    p = write_tmp_csv("rtss_test_store.csv", "type,phase,period,wcet,rel_dl\nP,0,5,1,5\n");
+    rtss::io::read_task_list_from_csv(store, p.string(), md);
+    EXPECT_EQ(store.size(), 1u);
+    store.release();
+    EXPECT_TRUE(store.empty());
+    rtss::io::read_task_list_from_csv(store, p.string(), md);
+    EXPECT_EQ(store.size(), 1u);
+    fs::remove(p);
+}
+
+TEST(TaskStore, LoadsBinaryTaskLists) {
+    fs::path p = write_tmp_csv("rtss_test_store.csv", "type,phase,period,wcet,rel_dl\nP,1,10,2,8\nA,4,0,3,0\n");
+    fs::path bin = fs::temp_directory_path() / "rtss_test_store.bin";
+    rtss::io::convert_task_list_csv_to_binary(p.string(), bin);
+    rtss::TaskStore store;
+    rtss::io::Metadata md;
+    rtss::io::read_task_list_binary(store, bin.string(), md);
+    ASSERT_EQ(store.size(), 2u);
+    EXPECT_FALSE(md.fully_periodic);
+    EXPECT_EQ(store.tasks()[1]->get_id(), 2);
+    fs::remove(p);
+    fs::remove(bin);
+}
+
+TEST(ReadCSV, HeapReadersLeaveNothingBehindOnAnError) {
+    fs::path p = write_tmp_csv("rtss_test_bad_task.csv",
+                               "type,phase,period,wcet,rel_dl\nP,0,5,1,5\nA,3,0,2,0\nP,x,5,1,5\n");
+    rtss::io::Metadata md;
+    std::vector<rtss::Task *> tasks;
+    EXPECT_THROW(rtss::io::read_task_list_from_csv(tasks, p.string(), md), std::runtime_error);
+    EXPECT_TRUE(tasks.empty());
+    std::vector<rtss::PeriodicTask *> periodic;
+    std::vector<rtss::AperiodicTask *> aperiodic;
+    EXPECT_THROW(rtss::io::read_task_list_from_csv(periodic, aperiodic, p.string(), md), std::runtime_error);
+    EXPECT_TRUE(periodic.empty());
+    EXPECT_TRUE(aperiodic.empty());
+    fs::remove(p);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "rtss/task.h"
+#include "rtss/taskset.h"
 
 using rtss::Task;
 using rtss::PeriodicTask;
@@ -161,3 +162,39 @@ TEST(AperiodicTaskTest, ToStringContainsArrivalAndWcet) {
     EXPECT_NE(s.find("arrival"), std::string::npos);
     EXPECT_NE(s.find("wcet"), std::string::npos);
 }
+
+TEST(TaskSetTest, SnapshotsTaskListWithKindTags) {
+    PeriodicTask pt(rtss::time::createTimeDurationMs(1), rtss::time::createTimeDurationMs(10),
+                    rtss::time::createTimeDurationMs(3), rtss::time::createTimeDurationMs(8));
+    pt.set_id(1);
+    AperiodicTask at(rtss::time::createTimeDurationMs(4), rtss::time::createTimeDurationMs(2));
+    at.set_id(2);
+    std::vector<Task *> tasks = {&pt, &at, Task::Idle()};
+
+    rtss::TaskSet ts(tasks);
+    ASSERT_EQ(ts.size(), 3u);
+    EXPECT_EQ(ts.kind(0), rtss::TaskKind::PERIODIC);
+    EXPECT_EQ(ts.kind(1), rtss::TaskKind::APERIODIC);
+    EXPECT_EQ(ts.kind(2), rtss::TaskKind::OTHER);
+    EXPECT_EQ(ts.id(1), 2);
+    EXPECT_EQ(rtss::time::toInt(ts.period(0)), 10);
+    EXPECT_EQ(rtss::time::toInt(ts.rel_dl(0)), 8);
+    EXPECT_EQ(rtss::time::toInt(ts.phase(1)), 4);
+    EXPECT_EQ(ts.period(1), rtss::time::ZERO_DURATION);
+    EXPECT_EQ(ts.wcets().size(), 3u);
+}
+
+TEST(TaskSetTest, DeadlineAndLaxityMatchPeriodicTask) {
+    PeriodicTask pt(rtss::time::createTimeDurationMs(2), rtss::time::createTimeDurationMs(10),
+                    rtss::time::createTimeDurationMs(3), rtss::time::createTimeDurationMs(7));
+    rtss::TaskSet ts;
+    ts.add_periodic(pt.get_phase(), pt.get_period(), pt.get_wcet(), pt.get_rel_dl());
+    for (int now_ms: {0, 2, 11, 12, 35}) {
+        auto now = rtss::time::createTimeDurationMs(now_ms);
+        EXPECT_EQ(ts.abs_dl(0, now), pt.calc_abs_dl(now));
+        EXPECT_EQ(ts.laxity(0, now), pt.calc_laxity(now));
+    }
+    ts.set_rem_tm(0, rtss::time::createTimeDurationMs(1));
+    ts.reset();
+    EXPECT_EQ(ts.rem_tm(0), ts.wcet(0));
+}
@@ -14,3 +14,44 @@ TEST(Time, ToInt_ReturnsCorrectMilliseconds) {
     int64_t time_ms = rtss::time::toInt(d);
     EXPECT_EQ(time_ms, 2500);
 }
+
+TEST(Time, ParseDuration_AcceptsUnitSuffixes) {
+    using namespace std::chrono;
+    rtss::time::TimeDuration d;
+    ASSERT_TRUE(rtss::time::parse_duration("15", d));
+    EXPECT_EQ(d, milliseconds(15));
+    ASSERT_TRUE(rtss::time::parse_duration("15ms", d));
+    EXPECT_EQ(d, milliseconds(15));
+    ASSERT_TRUE(rtss::time::parse_duration("2s", d));
+    EXPECT_EQ(d, seconds(2));
+    ASSERT_TRUE(rtss::time::parse_duration("-3000us", d));
+    EXPECT_EQ(d, milliseconds(-3));
+    // Below the tick only when it is not a whole number of ticks.
+    EXPECT_EQ(rtss::time::parse_duration("250us", d), rtss::time::TICK_NS <= 1'000);
+    EXPECT_EQ(rtss::time::parse_duration("7ns", d), rtss::time::TICK_NS == 1);
+
+    for (const char *bad: {"", "ms", "-", "1.5", "10 ms", "10m", "10msx", "9223372036854775808ns", "9223372036854775807s"}) {
+        EXPECT_FALSE(rtss::time::parse_duration(bad, d)) << bad;
+    }
+}
+
+TEST(Time, ToString_KeepsSubMillisecondPrecision) {
+    using namespace std::chrono;
+    EXPECT_EQ(rtss::time::to_string(milliseconds(12)), "12ms");
+    EXPECT_EQ(rtss::time::to_string(rtss::time::ZERO_DURATION), "0ms");
+    EXPECT_EQ(rtss::time::to_string(-milliseconds(3)), "-3ms");
+    if (rtss::time::TICK_NS <= 1'000) {
+        EXPECT_EQ(rtss::time::to_string(duration_cast<rtss::time::TimeDuration>(microseconds(250))), "250us");
+        EXPECT_EQ(rtss::time::to_string(duration_cast<rtss::time::TimeDuration>(microseconds(1500))), "1500us");
+    }
+    if (rtss::time::TICK_NS == 1) {
+        EXPECT_EQ(rtss::time::to_string(duration_cast<rtss::time::TimeDuration>(nanoseconds(7))), "7ns");
+    }
+    rtss::time::TimeDuration d;
+    ASSERT_TRUE(rtss::time::parse_duration(rtss::time::to_string(milliseconds(40)), d));
+    EXPECT_EQ(d, milliseconds(40));
+    // Nothing is written into a buffer that is too short.
+    char buf[4];
+    EXPECT_EQ(rtss::time::put_duration(buf, buf + sizeof(buf), milliseconds(1234)), buf);
+    EXPECT_EQ(rtss::time::put_duration(buf, buf + sizeof(buf), milliseconds(12)), buf + 4);
+}
@@ -0,0 +1,35 @@
+#ifndef RTSS_TESTS_TEST_UTIL_H
+#define RTSS_TESTS_TEST_UTIL_H
+
+#include <memory>
+
+#include "rtss/clock.h"
+#include "rtss/task.h"
+#include "rtss/schedulers/preemptive.h"
+
+// Helpers shared by the scheduler tests.
+namespace test_util {
+    inline std::unique_ptr<rtss::PeriodicTask> make_periodic(int phase, int period, int wcet, int rel_dl, short id) {
+        using rtss::time::createTimeDurationMs;
+        auto T = std::make_unique<rtss::PeriodicTask>(createTimeDurationMs(phase), createTimeDurationMs(period),
+                                                      createTimeDurationMs(wcet), createTimeDurationMs(rel_dl));
+        T->set_id(id);
+        return T;
+    }
+
+    // Released at time zero.
+    inline std::unique_ptr<rtss::PeriodicTask> make_periodic(int period, int wcet, int rel_dl, short id) {
+        return make_periodic(0, period, wcet, rel_dl, id);
+    }
+
+    // Runs `sched` for `nhyperperiods` in virtual time, without logging.
+    template<typename Scheduler>
+    const rtss::schedulers::SimulationStats &simulate(Scheduler &sched, size_t nhyperperiods) {
+        sched.set_clock(std::make_unique<rtss::time::VirtualClock>());
+        sched.set_verbose(false);
+        sched.run_scheduler(nhyperperiods);
+        return sched.get_stats();
+    }
+}
+
+#endif